@@ -710,6 +710,30 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo warmUpInternalPipelines = {
+        "warmUpInternalPipelines",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo optimizeSpirv = {
+        "optimizeSpirv",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo useDeviceCapabilitySnapshot = {
+        "useDeviceCapabilitySnapshot",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo verifyDeviceCapabilitySnapshot = {
+        "verifyDeviceCapabilitySnapshot",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo preferDeviceLocalMemoryHostVisible = {
         "preferDeviceLocalMemoryHostVisible",
         FeatureCategory::VulkanFeatures,
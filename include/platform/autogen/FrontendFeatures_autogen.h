@@ -153,6 +153,18 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo specializeGles1ProgramsInBackground = {
+        "specializeGles1ProgramsInBackground",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo forceGles1DynamicProgram = {
+        "forceGles1DynamicProgram",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
     FeatureInfo uncurrentEglSurfaceUponSurfaceDestroy = {
         "uncurrentEglSurfaceUponSurfaceDestroy",
         FeatureCategory::FrontendWorkarounds,
@@ -347,6 +347,15 @@ void PoolAllocator::popAll()
         pop();
 }
 
+size_t PoolAllocator::getTotalBytes() const
+{
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    return mTotalBytes;
+#else
+    return 0;
+#endif
+}
+
 void *PoolAllocator::allocate(size_t numBytes)
 {
     ASSERT(!mLocked);
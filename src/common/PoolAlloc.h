@@ -129,6 +129,11 @@ class PoolAllocator : angle::NonCopyable
 #endif
     }
 
+    // Total number of bytes requested through allocate() over the lifetime of the allocator.  As
+    // nothing is deallocated until pop(), the difference across a push()/pop() pair is the peak
+    // memory used by that scope, not counting page overhead.
+    size_t getTotalBytes() const;
+
     // There is no deallocate.  The point of this class is that deallocation can be skipped by the
     // user of it, as the model of use is to simultaneously deallocate everything at once by calling
     // pop(), and to not have to solve memory leak problems.
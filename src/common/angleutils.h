@@ -144,6 +144,7 @@ struct PerfMonitorTriplet
     FN(descriptorSetAllocations)                   \
     FN(descriptorSetCacheTotalSize)                \
     FN(descriptorSetCacheKeySizeBytes)             \
+    FN(descriptorSetCacheEvictions)                \
     FN(uniformsAndXfbDescriptorSetCacheHits)       \
     FN(uniformsAndXfbDescriptorSetCacheMisses)     \
     FN(uniformsAndXfbDescriptorSetCacheTotalSize)  \
@@ -160,8 +161,11 @@ struct PerfMonitorTriplet
     FN(vertexArraySyncStateCalls)                  \
     FN(allocateNewBufferBlockCalls)                \
     FN(bufferSuballocationCalls)                   \
+    FN(clBufferPoolAllocations)                    \
+    FN(clBufferPoolHits)                           \
     FN(dynamicBufferAllocations)                   \
     FN(framebufferCacheSize)                       \
+    FN(renderPassCacheSize)                        \
     FN(pendingSubmissionGarbageObjects)            \
     FN(graphicsDriverUniformsUpdated)
 
@@ -7,11 +7,12 @@
 #ifndef COMPILER_PREPROCESSOR_MACRO_H_
 #define COMPILER_PREPROCESSOR_MACRO_H_
 
-#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "common/hash_containers.h"
+
 namespace angle
 {
 
@@ -41,10 +42,12 @@ struct Macro
     Type type;
     std::string name;
     Parameters parameters;
+    // Immutable once the macro is defined.  Expansions of object-like macros read tokens straight
+    // out of this list instead of copying it.
     Replacements replacements;
 };
 
-typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
+typedef angle::HashMap<std::string, std::shared_ptr<Macro>> MacroSet;
 
 void PredefineMacro(MacroSet *macroSet, const char *name, int value);
 
@@ -44,13 +44,13 @@ class TokenLexer : public Lexer
         }
         else
         {
-            *token = *mIter++;
+            *token = std::move(*mIter++);
         }
     }
 
   private:
     TokenVector mTokens;
-    TokenVector::const_iterator mIter;
+    TokenVector::iterator mIter;
 };
 
 }  // anonymous namespace
@@ -196,7 +196,7 @@ void MacroExpander::getToken(Token *token)
 {
     if (mReserveToken.get())
     {
-        *token = *mReserveToken;
+        *token = std::move(*mReserveToken);
         mReserveToken.reset();
         return;
     }
@@ -209,7 +209,7 @@ void MacroExpander::getToken(Token *token)
 
     if (!mContextStack.empty())
     {
-        *token = mContextStack.back().get();
+        mContextStack.back().get(token);
     }
     else
     {
@@ -224,7 +224,11 @@ void MacroExpander::ungetToken(const Token &token)
     {
         MacroContext &context = mContextStack.back();
         context.unget();
-        ASSERT(context.replacements[context.index] == token);
+#if defined(ANGLE_ENABLE_ASSERTS)
+        Token expected;
+        context.peek(&expected);
+        ASSERT(expected == token);
+#endif  // ANGLE_ENABLE_ASSERTS
     }
     else
     {
@@ -251,6 +255,17 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
     ASSERT(identifier.type == Token::IDENTIFIER);
     ASSERT(identifier.text == macro->name);
 
+    // Object-like macros other than the predefined __LINE__ and __FILE__ expand to exactly their
+    // replacement list, so there is no need to copy it.
+    if (macro->type == Macro::kTypeObj && !macro->predefined)
+    {
+        macro->disabled = true;
+
+        mTotalTokensInContexts += macro->replacements.size();
+        mContextStack.emplace_back(std::move(macro), identifier);
+        return true;
+    }
+
     std::vector<Token> replacements;
     if (!expandMacro(*macro, identifier, &replacements))
         return false;
@@ -282,7 +297,7 @@ void MacroExpander::popMacro()
         context.macro->disabled = false;
     }
     context.macro->expansionCount--;
-    mTotalTokensInContexts -= context.replacements.size();
+    mTotalTokensInContexts -= context.size();
 }
 
 bool MacroExpander::expandMacro(const Macro &macro,
@@ -461,6 +476,7 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
                                        const std::vector<MacroArg> &args,
                                        std::vector<Token> *replacements)
 {
+    replacements->reserve(macro.replacements.size());
     for (std::size_t i = 0; i < macro.replacements.size(); ++i)
     {
         if (!replacements->empty() &&
@@ -503,14 +519,28 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
     }
 }
 
+MacroExpander::MacroContext::MacroContext(std::shared_ptr<Macro> macroIn, const Token &identifier)
+    : macro(std::move(macroIn)),
+      sharesMacroReplacements(true),
+      atStartOfLine(identifier.atStartOfLine()),
+      hasLeadingSpace(identifier.hasLeadingSpace()),
+      location(identifier.location)
+{}
+
 bool MacroExpander::MacroContext::empty() const
 {
-    return index == replacements.size();
+    return index == size();
+}
+
+size_t MacroExpander::MacroContext::size() const
+{
+    return sharesMacroReplacements ? macro->replacements.size() : ownedReplacements.size();
 }
 
-const Token &MacroExpander::MacroContext::get()
+void MacroExpander::MacroContext::get(Token *token)
 {
-    return replacements[index++];
+    peek(token);
+    ++index;
 }
 
 void MacroExpander::MacroContext::unget()
@@ -519,6 +549,24 @@ void MacroExpander::MacroContext::unget()
     --index;
 }
 
+void MacroExpander::MacroContext::peek(Token *token) const
+{
+    if (!sharesMacroReplacements)
+    {
+        *token = ownedReplacements[index];
+        return;
+    }
+
+    // Same as what expandMacro() does to the replacement list of a function-like macro.
+    *token = macro->replacements[index];
+    if (index == 0)
+    {
+        token->setAtStartOfLine(atStartOfLine);
+        token->setHasLeadingSpace(hasLeadingSpace);
+    }
+    token->location = location;
+}
+
 }  // namespace pp
 
 }  // namespace angle
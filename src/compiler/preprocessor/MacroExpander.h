@@ -13,6 +13,7 @@
 #include "compiler/preprocessor/Lexer.h"
 #include "compiler/preprocessor/Macro.h"
 #include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/SourceLocation.h"
 #include "compiler/preprocessor/Token.h"
 
 namespace angle
@@ -22,7 +23,6 @@ namespace pp
 {
 
 class Diagnostics;
-struct SourceLocation;
 
 class MacroExpander : public Lexer
 {
@@ -57,16 +57,28 @@ class MacroExpander : public Lexer
 
     struct MacroContext
     {
+        // Expands an object-like macro directly from its (immutable) replacement list.
+        MacroContext(std::shared_ptr<Macro> macro, const Token &identifier);
+        // Expands from a replacement list built for this invocation.
         MacroContext(std::shared_ptr<Macro> macro, std::vector<Token> &&replacements)
-            : macro(std::move(macro)), replacements(std::move(replacements))
+            : macro(std::move(macro)), ownedReplacements(std::move(replacements))
         {}
         bool empty() const;
-        const Token &get();
+        size_t size() const;
+        void get(Token *token);
         void unget();
+        void peek(Token *token) const;
 
         std::shared_ptr<Macro> macro;
-        std::vector<Token> replacements;
+        std::vector<Token> ownedReplacements;
         std::size_t index = 0;
+
+        // When set, tokens come from macro->replacements and get the padding properties and
+        // location of the invocation applied as they are read.
+        bool sharesMacroReplacements = false;
+        bool atStartOfLine           = false;
+        bool hasLeadingSpace         = false;
+        SourceLocation location;
     };
 
     Lexer *mLexer;
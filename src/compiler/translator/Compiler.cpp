@@ -264,19 +264,25 @@ namespace
 class [[nodiscard]] TScopedPoolAllocator
 {
   public:
-    TScopedPoolAllocator(angle::PoolAllocator *allocator) : mAllocator(allocator)
+    TScopedPoolAllocator(angle::PoolAllocator *allocator, size_t *allocatedBytesOut)
+        : mAllocator(allocator),
+          mAllocatedBytesOut(allocatedBytesOut),
+          mTotalBytesAtPush(allocator->getTotalBytes())
     {
         mAllocator->push();
         SetGlobalPoolAllocator(mAllocator);
     }
     ~TScopedPoolAllocator()
     {
+        *mAllocatedBytesOut = mAllocator->getTotalBytes() - mTotalBytesAtPush;
         SetGlobalPoolAllocator(nullptr);
         mAllocator->pop(angle::PoolAllocator::ReleaseStrategy::All);
     }
 
   private:
     angle::PoolAllocator *mAllocator;
+    size_t *mAllocatedBytesOut;
+    size_t mTotalBytesAtPush;
 };
 
 class [[nodiscard]] TScopedSymbolTableLevel
@@ -400,6 +406,7 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       mHasAnyPreciseType(false),
       mAdvancedBlendEquations(0),
       mUsesDerivatives(false),
+      mPoolAllocatedBytes(0),
       mCompileOptions{}
 {}
 
@@ -1369,7 +1376,7 @@ bool TCompiler::compile(const char *const shaderStrings[],
         compileOptions.flattenPragmaSTDGLInvariantAll = true;
     }
 
-    TScopedPoolAllocator scopedAlloc(&allocator);
+    TScopedPoolAllocator scopedAlloc(&allocator, &mPoolAllocatedBytes);
     TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
 
     if (root)
@@ -1381,6 +1388,20 @@ bool TCompiler::compile(const char *const shaderStrings[],
 
         if (compileOptions.objectCode)
         {
+            // The translated text is typically a few times larger than the source, given the
+            // declarations added by the translator and the renamed identifiers.  Reserve for it up
+            // front to avoid repeatedly growing the output as it's written.
+            if (!IsOutputSPIRV(mOutputType))
+            {
+                constexpr size_t kObjectCodeToSourceSizeRatio = 4;
+                size_t sourceLength                           = 0;
+                for (size_t index = 0; index < numStrings; ++index)
+                {
+                    sourceLength += strlen(shaderStrings[index]);
+                }
+                mInfoSink.obj.reserve(sourceLength * kObjectCodeToSourceSizeRatio);
+            }
+
             PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
             if (!translate(root, compileOptions, &perfDiagnostics))
             {
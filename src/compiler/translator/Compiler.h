@@ -111,6 +111,9 @@ class TCompiler : public TShHandleBase
     // Get results of the last compilation.
     int getShaderVersion() const { return mShaderVersion; }
     TInfoSink &getInfoSink() { return mInfoSink; }
+    // Since the pool memory is released only once compilation ends, this is also the peak pool
+    // memory usage of the compilation.
+    size_t getPoolAllocatedBytes() const { return mPoolAllocatedBytes; }
 
     bool specifyEarlyFragmentTests() { return mEarlyFragmentTestsSpecified = true; }
     bool isEarlyFragmentTestsSpecified() const { return mEarlyFragmentTestsSpecified; }
@@ -395,6 +398,9 @@ class TCompiler : public TShHandleBase
 
     TPragma mPragma;
 
+    // Pool memory allocated by the last compilation.
+    size_t mPoolAllocatedBytes;
+
     ShCompileOptions mCompileOptions;
 };
 
@@ -31,7 +31,7 @@ void TInfoSinkBase::prefix(Severity severity)
 
 TInfoSinkBase &TInfoSinkBase::operator<<(const ImmutableString &str)
 {
-    sink.append(str.data());
+    sink.append(str.data(), str.length());
     return *this;
 }
 
@@ -9,6 +9,8 @@
 
 #include <math.h>
 #include <stdlib.h>
+#include <charconv>
+#include <type_traits>
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Common.h"
 #include "compiler/translator/Severity.h"
@@ -43,9 +45,22 @@ class TInfoSinkBase
     template <typename T>
     TInfoSinkBase &operator<<(const T &t)
     {
-        TPersistStringStream stream = sh::InitializeStream<TPersistStringStream>();
-        stream << t;
-        sink.append(stream.str());
+        // Integers are by far the most common values written by the output passes (array sizes,
+        // indices, constants), so they are formatted directly into the sink.  Character types are
+        // excluded as streams write them as characters.
+        if constexpr (std::is_integral_v<T> && sizeof(T) > 1)
+        {
+            char buffer[kMaxIntegerChars];
+            std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), t);
+            ASSERT(result.ec == std::errc());
+            sink.append(buffer, result.ptr);
+        }
+        else
+        {
+            TPersistStringStream stream = sh::InitializeStream<TPersistStringStream>();
+            stream << t;
+            sink.append(stream.str());
+        }
         return *this;
     }
     // Override << operator for specific types. It is faster to append strings
@@ -67,7 +82,7 @@ class TInfoSinkBase
     }
     TInfoSinkBase &operator<<(const TString &str)
     {
-        sink.append(str.c_str());
+        sink.append(str.c_str(), str.length());
         return *this;
     }
     TInfoSinkBase &operator<<(const ImmutableString &str);
@@ -81,21 +96,22 @@ class TInfoSinkBase
         // Make sure that at least one decimal point is written. If a number
         // does not have a fractional part, the default precision format does
         // not write the decimal portion which gets interpreted as integer by
-        // the compiler.
-        TPersistStringStream stream = sh::InitializeStream<TPersistStringStream>();
+        // the compiler.  Otherwise, 9 significant digits are enough for the
+        // value to round-trip.  std::to_chars formats like printf in the "C"
+        // locale, i.e. "%.1f" and "%.9g" respectively.
+        char buffer[kMaxFloatChars];
+        std::to_chars_result result;
         if (fractionalPart(f) == 0.0f)
         {
-            stream.precision(1);
-            stream << std::showpoint << std::fixed << f;
+            result = std::to_chars(buffer, buffer + sizeof(buffer), f, std::chars_format::fixed, 1);
         }
         else
         {
-            stream.unsetf(std::ios::fixed);
-            stream.unsetf(std::ios::scientific);
-            stream.precision(9);
-            stream << f;
+            result =
+                std::to_chars(buffer, buffer + sizeof(buffer), f, std::chars_format::general, 9);
         }
-        sink.append(stream.str());
+        ASSERT(result.ec == std::errc());
+        sink.append(buffer, result.ptr);
         return *this;
     }
     // Write boolean values as their names instead of integral value.
@@ -111,6 +127,7 @@ class TInfoSinkBase
         sink.clear();
         binarySink.clear();
     }
+    void reserve(size_t size) { sink.reserve(size); }
     int size() { return static_cast<int>(isBinary() ? binarySink.size() : sink.size()); }
 
     const TPersistString &str() const
@@ -136,6 +153,11 @@ class TInfoSinkBase
     }
 
   private:
+    // Enough for any 64-bit integer, including the sign.
+    static constexpr size_t kMaxIntegerChars = 24;
+    // Enough for FLT_MAX written in fixed notation with one decimal, including the sign.
+    static constexpr size_t kMaxFloatChars = 48;
+
     // The data in the info sink is either in human readable form (|sink|) or binary (|binarySink|).
     TPersistString sink;
     BinaryBlob binarySink;
@@ -1593,17 +1593,31 @@ void SPIRVBuilder::startNewFunction(spirv::IdRef functionId, const TFunction *fu
     ASSERT(mSpirvCurrentFunctionBlocks.empty());
 
     // Add the first block of the function.
-    mSpirvCurrentFunctionBlocks.emplace_back();
-    mSpirvCurrentFunctionBlocks.back().labelId = getNewId({});
+    addFunctionBlock(getNewId({}));
 
     // Output debug information.
     writeDebugName(functionId, getName(func).data());
 }
 
+void SPIRVBuilder::addFunctionBlock(spirv::IdRef labelId)
+{
+    if (mSpirvFreeFunctionBlocks.empty())
+    {
+        mSpirvCurrentFunctionBlocks.emplace_back();
+    }
+    else
+    {
+        mSpirvCurrentFunctionBlocks.push_back(std::move(mSpirvFreeFunctionBlocks.back()));
+        mSpirvFreeFunctionBlocks.pop_back();
+    }
+
+    mSpirvCurrentFunctionBlocks.back().labelId = labelId;
+}
+
 void SPIRVBuilder::assembleSpirvFunctionBlocks()
 {
     // Take all the blocks and place them in the functions section of SPIR-V in sequence.
-    for (const SpirvBlock &block : mSpirvCurrentFunctionBlocks)
+    for (SpirvBlock &block : mSpirvCurrentFunctionBlocks)
     {
         // Every block must be properly terminated.
         ASSERT(block.isTerminated);
@@ -1617,9 +1631,14 @@ void SPIRVBuilder::assembleSpirvFunctionBlocks()
 
         // Add the body of the block.
         mSpirvFunctions.insert(mSpirvFunctions.end(), block.body.begin(), block.body.end());
+
+        // Clean up, keeping the storage around for the blocks of the next function.
+        block.localVariables.clear();
+        block.body.clear();
+        block.isTerminated = false;
+        mSpirvFreeFunctionBlocks.push_back(std::move(block));
     }
 
-    // Clean up.
     mSpirvCurrentFunctionBlocks.clear();
 }
 
@@ -1746,8 +1765,7 @@ void SPIRVBuilder::nextConditionalBlock()
     ASSERT(isCurrentFunctionBlockTerminated());
 
     // Generate a new block.
-    mSpirvCurrentFunctionBlocks.emplace_back();
-    mSpirvCurrentFunctionBlocks.back().labelId = blockId;
+    addFunctionBlock(blockId);
 }
 
 void SPIRVBuilder::endConditional()
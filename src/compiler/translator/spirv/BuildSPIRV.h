@@ -431,6 +431,7 @@ class SPIRVBuilder : angle::NonCopyable
 
   private:
     void predefineCommonTypes();
+    void addFunctionBlock(spirv::IdRef labelId);
     SpirvTypeData declareType(const SpirvType &type, const TSymbol *block);
 
     uint32_t calculateBaseAlignmentAndSize(const SpirvType &type, uint32_t *sizeInStorageBlockOut);
@@ -518,6 +519,9 @@ class SPIRVBuilder : angle::NonCopyable
     //
     // The last block in this list is the one currently being written to.
     std::vector<SpirvBlock> mSpirvCurrentFunctionBlocks;
+    // Blocks of previously assembled functions.  Their (cleared) storage is reused for the blocks
+    // of the next functions, so that large shaders don't reallocate every block's blobs.
+    std::vector<SpirvBlock> mSpirvFreeFunctionBlocks;
 
     // List of constants that are already defined (for reuse).
     spirv::IdRef mBoolConstants[2];
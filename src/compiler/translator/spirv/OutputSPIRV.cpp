@@ -18,6 +18,7 @@
 #include "compiler/translator/tree_util/FindPreciseNodes.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
 
+#include <algorithm>
 #include <cfloat>
 
 // Extended instructions
@@ -124,6 +125,74 @@ struct NodeData
     AccessChain accessChain;
 };
 
+// Resets NodeData to its default state, but keeps the storage of its vectors for reuse.
+void ResetNodeData(NodeData *data)
+{
+    std::vector<SpirvIdOrLiteral> idList = std::move(data->idList);
+    std::vector<uint32_t> swizzles       = std::move(data->accessChain.swizzles);
+    idList.clear();
+    swizzles.clear();
+
+    *data                      = {};
+    data->idList               = std::move(idList);
+    data->accessChain.swizzles = std::move(swizzles);
+}
+
+// The stack of NodeData used during traversal.  Every node pushes and pops an entry, so instead of
+// destroying popped entries (and freeing their vectors), they are kept around and reset when the
+// stack grows again.  This avoids a large number of allocations in big functions.
+class NodeDataStack : angle::NonCopyable
+{
+  public:
+    bool empty() const { return mSize == 0; }
+    size_t size() const { return mSize; }
+
+    NodeData &back()
+    {
+        ASSERT(mSize > 0);
+        return mData[mSize - 1];
+    }
+    NodeData &operator[](size_t index)
+    {
+        ASSERT(index < mSize);
+        return mData[index];
+    }
+
+    void emplace_back()
+    {
+        if (mSize == mData.size())
+        {
+            mData.emplace_back();
+        }
+        else
+        {
+            ResetNodeData(&mData[mSize]);
+        }
+        ++mSize;
+    }
+    void pop_back()
+    {
+        ASSERT(mSize > 0);
+        --mSize;
+    }
+    void resize(size_t size)
+    {
+        ASSERT(size <= mSize);
+        mSize = size;
+    }
+    // Removes the entry at |index|, shifting the ones after it down.
+    void erase(size_t index)
+    {
+        ASSERT(index < mSize);
+        std::rotate(mData.begin() + index, mData.begin() + index + 1, mData.begin() + mSize);
+        --mSize;
+    }
+
+  private:
+    std::vector<NodeData> mData;
+    size_t mSize = 0;
+};
+
 struct FunctionIds
 {
     // Id of the function type, return type and parameter types.
@@ -375,7 +444,7 @@ class OutputSPIRVTraverser : public TIntermTraverser
     // Traversal state.  Nodes generally push() once to this stack on PreVisit.  On InVisit and
     // PostVisit, they pop() once (data corresponding to the result of the child) and accumulate it
     // in back() (data corresponding to the node itself).  On PostVisit, code is generated.
-    std::vector<NodeData> mNodeData;
+    NodeDataStack mNodeData;
 
     // A map of TSymbol to its SPIR-V id.  This could be a:
     //
@@ -745,7 +814,7 @@ void OutputSPIRVTraverser::nodeDataInitLValue(NodeData *data,
                                               spv::StorageClass storageClass,
                                               const SpirvTypeSpec &typeSpec) const
 {
-    *data = {};
+    ResetNodeData(data);
 
     // Initialize the access chain as an lvalue.  Useful when an access chain is resolved, but needs
     // to be replaced by a reference to a temporary variable holding the result.
@@ -760,7 +829,7 @@ void OutputSPIRVTraverser::nodeDataInitRValue(NodeData *data,
                                               spirv::IdRef baseId,
                                               spirv::IdRef typeId) const
 {
-    *data = {};
+    ResetNodeData(data);
 
     // Initialize the access chain as an rvalue.  Useful when an access chain is resolved, and needs
     // to be replaced by a reference to it.
@@ -5030,7 +5099,7 @@ bool OutputSPIRVTraverser::visitBinary(Visit visit, TIntermBinary *node)
             // When the expression a,b is visited, all side effects of a and b are already
             // processed.  What's left is to to replace the expression with the result of b.  This
             // is simply done by dropping the left node and placing the right node as the result.
-            mNodeData.erase(mNodeData.begin() + mNodeData.size() - 2);
+            mNodeData.erase(mNodeData.size() - 2);
             break;
 
         default:
@@ -6,6 +6,7 @@
 
 #include "compiler/translator/tree_util/IntermTraverse.h"
 
+#include "common/hash_containers.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/SymbolTable.h"
@@ -512,31 +513,102 @@ bool TIntermTraverser::CompareInsertion(const NodeInsertMultipleEntry &a,
 bool TIntermTraverser::updateTree(TCompiler *compiler, TIntermNode *node)
 {
     // Sort the insertions so that insertion position is increasing and same position insertions are
-    // not reordered. The insertions are processed in reverse order so that multiple insertions to
-    // the same parent node are handled correctly.
+    // not reordered.  The insertions to each parent are then applied by rebuilding the parent's
+    // statement list once, instead of shifting the statements that follow each insertion point.
     std::stable_sort(mInsertions.begin(), mInsertions.end(), CompareInsertion);
-    for (size_t ii = 0; ii < mInsertions.size(); ++ii)
+    size_t groupBegin = 0;
+    while (groupBegin < mInsertions.size())
     {
-        // If two insertions are to the same position, insert them in the order they were specified.
-        // The std::stable_sort call above will automatically guarantee this.
-        const NodeInsertMultipleEntry &insertion = mInsertions[mInsertions.size() - ii - 1];
-        ASSERT(insertion.parent);
-        if (!insertion.insertionsAfter.empty())
+        TIntermBlock *parent = mInsertions[groupBegin].parent;
+        ASSERT(parent);
+
+        size_t groupEnd    = groupBegin;
+        size_t insertCount = 0;
+        while (groupEnd < mInsertions.size() && mInsertions[groupEnd].parent == parent)
+        {
+            insertCount += mInsertions[groupEnd].insertionsBefore.size() +
+                           mInsertions[groupEnd].insertionsAfter.size();
+            ++groupEnd;
+        }
+
+        if (groupEnd - groupBegin == 1)
         {
-            bool inserted = insertion.parent->insertChildNodes(insertion.position + 1,
-                                                               insertion.insertionsAfter);
-            ASSERT(inserted);
+            const NodeInsertMultipleEntry &insertion = mInsertions[groupBegin];
+            if (!insertion.insertionsAfter.empty())
+            {
+                bool inserted =
+                    parent->insertChildNodes(insertion.position + 1, insertion.insertionsAfter);
+                ASSERT(inserted);
+            }
+            if (!insertion.insertionsBefore.empty())
+            {
+                bool inserted =
+                    parent->insertChildNodes(insertion.position, insertion.insertionsBefore);
+                ASSERT(inserted);
+            }
+            groupBegin = groupEnd;
+            continue;
         }
-        if (!insertion.insertionsBefore.empty())
+
+        const TIntermSequence &statements = *parent->getSequence();
+        TIntermSequence newStatements;
+        newStatements.reserve(statements.size() + insertCount);
+
+        // If two insertions are to the same position, insert them in the order they were specified.
+        // The std::stable_sort call above will automatically guarantee this.
+        size_t insertion = groupBegin;
+        for (size_t position = 0; position <= statements.size(); ++position)
         {
-            bool inserted =
-                insertion.parent->insertChildNodes(insertion.position, insertion.insertionsBefore);
-            ASSERT(inserted);
+            size_t positionEnd = insertion;
+            while (positionEnd < groupEnd && mInsertions[positionEnd].position == position)
+            {
+                const TIntermSequence &before = mInsertions[positionEnd].insertionsBefore;
+                newStatements.insert(newStatements.end(), before.begin(), before.end());
+                ++positionEnd;
+            }
+            if (position < statements.size())
+            {
+                newStatements.push_back(statements[position]);
+            }
+            for (; insertion < positionEnd; ++insertion)
+            {
+                const TIntermSequence &after = mInsertions[insertion].insertionsAfter;
+                ASSERT(position < statements.size() || after.empty());
+                newStatements.insert(newStatements.end(), after.begin(), after.end());
+            }
         }
+        ASSERT(insertion == groupEnd);
+
+        parent->replaceAllChildren(std::move(newStatements));
+        groupBegin = groupEnd;
     }
+
+    // Nodes replaced so far that did not become children of their replacement, with the index of
+    // the replacement entry.
+    struct ReplacedNode
+    {
+        TIntermNode *replacement;
+        size_t index;
+    };
+    angle::HashMap<TIntermNode *, ReplacedNode> replacedNodes;
+
     for (size_t ii = 0; ii < mReplacements.size(); ++ii)
     {
-        const NodeUpdateEntry &replacement = mReplacements[ii];
+        NodeUpdateEntry &replacement = mReplacements[ii];
+
+        // In AST traversing, a parent is visited before its children.  If the parent of this node
+        // was replaced, we need to make sure we don't update the replaced node; instead, we update
+        // the replacement node.  The replacement may itself have been replaced by a later entry,
+        // so follow the chain of replacements in the order they were made.
+        size_t minIndex = 0;
+        for (auto iter = replacedNodes.find(replacement.parent);
+             iter != replacedNodes.end() && iter->second.index >= minIndex;
+             iter = replacedNodes.find(replacement.parent))
+        {
+            replacement.parent = iter->second.replacement;
+            minIndex           = iter->second.index + 1;
+        }
+
         ASSERT(replacement.parent);
         bool replaced =
             replacement.parent->replaceChildNode(replacement.original, replacement.replacement);
@@ -560,25 +632,64 @@ bool TIntermTraverser::updateTree(TCompiler *compiler, TIntermNode *node)
 
         if (!replacement.originalBecomesChildOfReplacement)
         {
-            // In AST traversing, a parent is visited before its children.
-            // After we replace a node, if its immediate child is to
-            // be replaced, we need to make sure we don't update the replaced
-            // node; instead, we update the replacement node.
-            for (size_t jj = ii + 1; jj < mReplacements.size(); ++jj)
-            {
-                NodeUpdateEntry &replacement2 = mReplacements[jj];
-                if (replacement2.parent == replacement.original)
-                    replacement2.parent = replacement.replacement;
-            }
+            replacedNodes.emplace(replacement.original, ReplacedNode{replacement.replacement, ii});
         }
     }
-    for (size_t ii = 0; ii < mMultiReplacements.size(); ++ii)
+
+    // Likewise, rebuild the child list of each parent once for all of its multi-replacements.
+    std::stable_sort(mMultiReplacements.begin(), mMultiReplacements.end(),
+                     [](const NodeReplaceWithMultipleEntry &a,
+                        const NodeReplaceWithMultipleEntry &b) { return a.parent < b.parent; });
+    groupBegin = 0;
+    while (groupBegin < mMultiReplacements.size())
     {
-        const NodeReplaceWithMultipleEntry &replacement = mMultiReplacements[ii];
-        ASSERT(replacement.parent);
-        bool replaced = replacement.parent->replaceChildNodeWithMultiple(replacement.original,
-                                                                         replacement.replacements);
-        ASSERT(replaced);
+        TIntermAggregateBase *parent = mMultiReplacements[groupBegin].parent;
+        ASSERT(parent);
+
+        size_t groupEnd = groupBegin + 1;
+        while (groupEnd < mMultiReplacements.size() &&
+               mMultiReplacements[groupEnd].parent == parent)
+        {
+            ++groupEnd;
+        }
+
+        if (groupEnd - groupBegin == 1)
+        {
+            const NodeReplaceWithMultipleEntry &replacement = mMultiReplacements[groupBegin];
+            bool replaced = parent->replaceChildNodeWithMultiple(replacement.original,
+                                                                 replacement.replacements);
+            ASSERT(replaced);
+            groupBegin = groupEnd;
+            continue;
+        }
+
+        angle::HashMap<TIntermNode *, const TIntermSequence *> replacementsByOriginal;
+        size_t newSize = parent->getSequence()->size();
+        for (size_t ii = groupBegin; ii < groupEnd; ++ii)
+        {
+            const NodeReplaceWithMultipleEntry &replacement = mMultiReplacements[ii];
+            replacementsByOriginal.emplace(replacement.original, &replacement.replacements);
+            newSize += replacement.replacements.size();
+        }
+
+        TIntermSequence newSequence;
+        newSequence.reserve(newSize);
+        for (TIntermNode *child : *parent->getSequence())
+        {
+            auto iter = replacementsByOriginal.find(child);
+            if (iter == replacementsByOriginal.end())
+            {
+                newSequence.push_back(child);
+                continue;
+            }
+            newSequence.insert(newSequence.end(), iter->second->begin(), iter->second->end());
+            // Only the first occurrence of a node is replaced.
+            replacementsByOriginal.erase(iter);
+        }
+        ASSERT(replacementsByOriginal.empty());
+
+        *parent->getSequence() = std::move(newSequence);
+        groupBegin             = groupEnd;
     }
 
     clearReplacementQueue();
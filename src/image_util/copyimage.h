@@ -30,6 +30,25 @@ void ReadDepthStencil(const uint8_t *source, uint8_t *dest);
 template <typename DestType>
 void WriteDepthStencil(const uint8_t *source, uint8_t *dest);
 
+// Row variants of the above.  The read functions gather |pixelCount| pixels spaced
+// |sourcePixelPitch| bytes apart into a tightly packed array of Color<colorDataType> (or
+// DepthStencil), and the write functions scatter such an array into pixels spaced
+// |destPixelPitch| bytes apart.  This amortizes the per-pixel indirect call of the functions above.
+template <typename sourceType, typename colorDataType>
+void ReadColorRow(const uint8_t *source, int sourcePixelPitch, uint8_t *dest, int pixelCount);
+
+template <typename destType, typename colorDataType>
+void WriteColorRow(const uint8_t *source, uint8_t *dest, int destPixelPitch, int pixelCount);
+
+template <typename SourceType>
+void ReadDepthStencilRow(const uint8_t *source,
+                         int sourcePixelPitch,
+                         uint8_t *dest,
+                         int pixelCount);
+
+template <typename DestType>
+void WriteDepthStencilRow(const uint8_t *source, uint8_t *dest, int destPixelPitch, int pixelCount);
+
 void CopyBGRA8ToRGBA8(const uint8_t *source,
                       int srcXAxisPitch,
                       int srcYAxisPitch,
@@ -39,6 +58,33 @@ void CopyBGRA8ToRGBA8(const uint8_t *source,
                       int destWidth,
                       int destHeight);
 
+void CopyRGBA8ToBGRA8(const uint8_t *source,
+                      int srcXAxisPitch,
+                      int srcYAxisPitch,
+                      uint8_t *dest,
+                      int destXAxisPitch,
+                      int destYAxisPitch,
+                      int destWidth,
+                      int destHeight);
+
+void CopyR5G6B5ToRGBA8(const uint8_t *source,
+                       int srcXAxisPitch,
+                       int srcYAxisPitch,
+                       uint8_t *dest,
+                       int destXAxisPitch,
+                       int destYAxisPitch,
+                       int destWidth,
+                       int destHeight);
+
+void CopyRGBA16FToRGBA32F(const uint8_t *source,
+                          int srcXAxisPitch,
+                          int srcYAxisPitch,
+                          uint8_t *dest,
+                          int destXAxisPitch,
+                          int destYAxisPitch,
+                          int destWidth,
+                          int destHeight);
+
 }  // namespace angle
 
 #include "copyimage.inc"
@@ -9111,6 +9111,13 @@ std::shared_ptr<angle::WorkerThreadPool> Context::getShaderCompileThreadPool() c
     {
         return mDisplay->getMultiThreadPool();
     }
+    // GLES1 contexts don't expose GL_KHR_parallel_shader_compile.  The only programs they compile
+    // are the GLES1 emulation programs, which may be specialized in the background.
+    if (getClientVersion() < ES_2_0 &&
+        getFrontendFeatures().specializeGles1ProgramsInBackground.enabled)
+    {
+        return mDisplay->getMultiThreadPool();
+    }
     return mDisplay->getSingleThreadPool();
 }
 
@@ -9,6 +9,8 @@
 #include "libANGLE/GLES1Renderer.h"
 
 #include <string.h>
+#include <algorithm>
+#include <array>
 #include <iterator>
 #include <sstream>
 #include <vector>
@@ -22,6 +24,7 @@
 #include "libANGLE/State.h"
 #include "libANGLE/context_private_call.inl.h"
 #include "libANGLE/renderer/ContextImpl.h"
+#include "platform/autogen/FrontendFeatures_autogen.h"
 
 namespace
 {
@@ -42,6 +45,67 @@ uint32_t GetLogicOpUniform(const gl::FramebufferAttachment *color, gl::LogicalOp
 
 namespace gl
 {
+namespace
+{
+// The shader state that the dynamic program takes from uniforms, with the names of the uniforms.
+struct DynamicStateEnable
+{
+    GLES1StateEnables state;
+    const char *name;
+};
+
+constexpr DynamicStateEnable kDynamicStateEnables[] = {
+    {GLES1StateEnables::Lighting, "enable_lighting"},
+    {GLES1StateEnables::ColorMaterial, "enable_color_material"},
+    {GLES1StateEnables::DrawTexture, "enable_draw_texture"},
+    {GLES1StateEnables::PointRasterization, "point_rasterization"},
+    {GLES1StateEnables::RescaleNormal, "enable_rescale_normal"},
+    {GLES1StateEnables::Normalize, "enable_normalize"},
+    {GLES1StateEnables::Fog, "enable_fog"},
+    {GLES1StateEnables::ClipPlanes, "enable_clip_planes"},
+    {GLES1StateEnables::PointSprite, "point_sprite_enabled"},
+    {GLES1StateEnables::AlphaTest, "enable_alpha_test"},
+    {GLES1StateEnables::ShadeModelFlat, "shade_model_flat"},
+};
+
+struct DynamicStateBoolTexArray
+{
+    const char *name;
+    GLES1ShaderState::BoolTexArray GLES1ShaderState::*member;
+};
+
+constexpr DynamicStateBoolTexArray kDynamicStateBoolTexArrays[] = {
+    {"enable_texture_2d", &GLES1ShaderState::tex2DEnables},
+    {"enable_texture_cube_map", &GLES1ShaderState::texCubeEnables},
+    {"point_sprite_coord_replace", &GLES1ShaderState::pointSpriteCoordReplaces},
+};
+
+struct DynamicStateUintTexArray
+{
+    const char *name;
+    GLES1ShaderState::UintTexArray GLES1ShaderState::*member;
+};
+
+constexpr DynamicStateUintTexArray kDynamicStateUintTexArrays[] = {
+    {"texture_format", &GLES1ShaderState::tex2DFormats},
+    {"texture_env_mode", &GLES1ShaderState::texEnvModes},
+    {"combine_rgb", &GLES1ShaderState::texCombineRgbs},
+    {"combine_alpha", &GLES1ShaderState::texCombineAlphas},
+    {"src0_rgb", &GLES1ShaderState::texCombineSrc0Rgbs},
+    {"src0_alpha", &GLES1ShaderState::texCombineSrc0Alphas},
+    {"src1_rgb", &GLES1ShaderState::texCombineSrc1Rgbs},
+    {"src1_alpha", &GLES1ShaderState::texCombineSrc1Alphas},
+    {"src2_rgb", &GLES1ShaderState::texCombineSrc2Rgbs},
+    {"src2_alpha", &GLES1ShaderState::texCombineSrc2Alphas},
+    {"op0_rgb", &GLES1ShaderState::texCombineOp0Rgbs},
+    {"op0_alpha", &GLES1ShaderState::texCombineOp0Alphas},
+    {"op1_rgb", &GLES1ShaderState::texCombineOp1Rgbs},
+    {"op1_alpha", &GLES1ShaderState::texCombineOp1Alphas},
+    {"op2_rgb", &GLES1ShaderState::texCombineOp2Rgbs},
+    {"op2_alpha", &GLES1ShaderState::texCombineOp2Alphas},
+};
+}  // anonymous namespace
+
 GLES1ShaderState::GLES1ShaderState()  = default;
 GLES1ShaderState::~GLES1ShaderState() = default;
 GLES1ShaderState::GLES1ShaderState(const GLES1ShaderState &other)
@@ -76,6 +140,11 @@ void GLES1Renderer::onDestroy(Context *context, State *state)
             const GLES1UberShaderState &UberShaderState = iter.second;
             mShaderPrograms->deleteProgram(context, {UberShaderState.programState.program});
         }
+        if (mDynamicProgramInitialized)
+        {
+            mShaderPrograms->deleteProgram(context, {mDynamicProgramState.programState.program});
+            mDynamicProgramInitialized = false;
+        }
         mShaderPrograms->release(context);
         mShaderPrograms             = nullptr;
         mRendererProgramInitialized = false;
@@ -643,6 +712,7 @@ Program *GLES1Renderer::getProgram(ShaderProgramID handle) const
 angle::Result GLES1Renderer::compileShader(Context *context,
                                            ShaderType shaderType,
                                            const char *src,
+                                           angle::JobResultExpectancy resultExpectancy,
                                            ShaderProgramID *shaderOut)
 {
     rx::ContextImpl *implementation = context->getImplementation();
@@ -654,10 +724,17 @@ angle::Result GLES1Renderer::compileShader(Context *context,
     ANGLE_CHECK(context, shaderObject, "Missing shader object", GL_INVALID_OPERATION);
 
     shaderObject->setSource(context, 1, &src, nullptr);
-    shaderObject->compile(context, angle::JobResultExpectancy::Immediate);
+    shaderObject->compile(context, resultExpectancy);
 
     *shaderOut = shader;
 
+    // Compile errors of a shader compiled in the background are reported when the program link
+    // completes.
+    if (resultExpectancy == angle::JobResultExpectancy::Future)
+    {
+        return angle::Result::Continue;
+    }
+
     if (!shaderObject->isCompiled(context))
     {
         GLint infoLogLength = shaderObject->getInfoLogLength(context);
@@ -678,6 +755,7 @@ angle::Result GLES1Renderer::linkProgram(Context *context,
                                          ShaderProgramID vertexShader,
                                          ShaderProgramID fragmentShader,
                                          const angle::HashMap<GLint, std::string> &attribLocs,
+                                         angle::JobResultExpectancy resultExpectancy,
                                          ShaderProgramID *programOut)
 {
     ShaderProgramID program = mShaderPrograms->createProgram(context->getImplementation());
@@ -697,10 +775,28 @@ angle::Result GLES1Renderer::linkProgram(Context *context,
         programObject->bindAttributeLocation(context, index, name.c_str());
     }
 
-    ANGLE_TRY(programObject->link(context, angle::JobResultExpectancy::Immediate));
+    ANGLE_TRY(programObject->link(context, resultExpectancy));
+
+    // Detaching the shaders would wait for the link; that's deferred to |finishProgramLink|.
+    if (resultExpectancy == angle::JobResultExpectancy::Future)
+    {
+        return angle::Result::Continue;
+    }
+
     programObject->resolveLink(context);
 
     ANGLE_TRY(glState->setProgram(context, programObject));
+    ANGLE_TRY(checkProgramLinked(context, programObject));
+
+    programObject->detachShader(context, getShader(vertexShader));
+    programObject->detachShader(context, getShader(fragmentShader));
+
+    return angle::Result::Continue;
+}
+
+angle::Result GLES1Renderer::checkProgramLinked(Context *context, Program *programObject)
+{
+    programObject->resolveLink(context);
 
     if (!programObject->isLinked())
     {
@@ -713,9 +809,6 @@ angle::Result GLES1Renderer::linkProgram(Context *context,
         return angle::Result::Stop;
     }
 
-    programObject->detachShader(context, getShader(vertexShader));
-    programObject->detachShader(context, getShader(fragmentShader));
-
     return angle::Result::Continue;
 }
 
@@ -913,10 +1006,42 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
                                                        State *glState,
                                                        GLES1State *gles1State)
 {
+    mUseDynamicProgram = false;
+
+    if (!mRendererProgramInitialized)
+    {
+        mShaderPrograms             = new ShaderProgramManager();
+        mRendererProgramInitialized = true;
+    }
+
+    // For testing, draw with the dynamic program whenever it can implement the state.
+    if (context->getFrontendFeatures().forceGles1DynamicProgram.enabled &&
+        !mShaderState.mGLES1StateEnabled[GLES1StateEnables::LogicOpThroughFramebufferFetch])
+    {
+        return useDynamicProgram(context, glState, gles1State);
+    }
+
     // See if we have the shader for this combination of states
-    if (mUberShaderState.find(mShaderState) != mUberShaderState.end())
+    auto iter = mUberShaderState.find(mShaderState);
+    if (iter != mUberShaderState.end())
     {
-        Program *programObject = getProgram(getUberShaderState().programState.program);
+        GLES1UberShaderState &uberShaderState = iter->second;
+        Program *programObject                = getProgram(uberShaderState.programState.program);
+
+        if (uberShaderState.isLinkPending)
+        {
+            // Keep drawing with the dynamic program until the specialized program is linked.
+            if (programObject->isLinking())
+            {
+                return useDynamicProgram(context, glState, gles1State);
+            }
+
+            ANGLE_TRY(finishProgramLink(context, &uberShaderState));
+            ANGLE_TRY(initializeProgramState(context, glState, &uberShaderState.programState));
+
+            gles1State->setAllDirty();
+            return angle::Result::Continue;
+        }
 
         // If this is different than the current program, we need to sync everything
         // TODO: This could be optimized to only dirty state that differs between the two programs
@@ -929,30 +1054,66 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
         return angle::Result::Continue;
     }
 
-    if (!mRendererProgramInitialized)
+    // If we get here, we don't have a shader for this state, need to create it.  If possible, this
+    // is done in the background, and the dynamic program is used until it's ready.  The dynamic
+    // program cannot implement logic op through framebuffer fetch, as that changes the fragment
+    // shader's outputs.
+    const bool linkInBackground =
+        context->getFrontendFeatures().specializeGles1ProgramsInBackground.enabled &&
+        !mShaderState.mGLES1StateEnabled[GLES1StateEnables::LogicOpThroughFramebufferFetch];
+
+    GLES1UberShaderState &uberShaderState = mUberShaderState[mShaderState];
+
+    if (linkInBackground)
     {
-        mShaderPrograms = new ShaderProgramManager();
+        ANGLE_TRY(createProgram(context, glState, false, angle::JobResultExpectancy::Future,
+                                &uberShaderState));
+        return useDynamicProgram(context, glState, gles1State);
     }
 
-    // If we get here, we don't have a shader for this state, need to create it
-    GLES1ProgramState &programState = mUberShaderState[mShaderState].programState;
+    ANGLE_TRY(createProgram(context, glState, false, angle::JobResultExpectancy::Immediate,
+                            &uberShaderState));
+    ANGLE_TRY(initializeProgramState(context, glState, &uberShaderState.programState));
 
+    // We just created a new program, we need to sync everything
+    gles1State->setAllDirty();
+
+    return angle::Result::Continue;
+}
+
+angle::Result GLES1Renderer::createProgram(Context *context,
+                                           State *glState,
+                                           bool isDynamic,
+                                           angle::JobResultExpectancy resultExpectancy,
+                                           GLES1UberShaderState *uberShaderState)
+{
     ShaderProgramID vertexShader;
     ShaderProgramID fragmentShader;
 
     // Set the count of texture units to a minimum to avoid requiring unnecessary vertex attributes
-    // and take up varying slots.
+    // and take up varying slots.  The dynamic program has to support all of them.
     uint32_t maxTexUnitsEnabled = 0;
     for (int i = 0; i < kTexUnitCount; i++)
     {
-        if (mShaderState.texCubeEnables[i] || mShaderState.tex2DEnables[i])
+        if (isDynamic || mShaderState.texCubeEnables[i] || mShaderState.tex2DEnables[i])
         {
             maxTexUnitsEnabled = i + 1;
         }
     }
 
+    const bool logicOpThroughFramebufferFetch =
+        !isDynamic &&
+        mShaderState.mGLES1StateEnabled[GLES1StateEnables::LogicOpThroughFramebufferFetch];
+
     std::stringstream GLES1DrawVShaderStateDefs;
-    addVertexShaderDefs(GLES1DrawVShaderStateDefs);
+    if (isDynamic)
+    {
+        GLES1DrawVShaderStateDefs << kGLES1DrawVShaderDynamicStateDefs;
+    }
+    else
+    {
+        addVertexShaderDefs(GLES1DrawVShaderStateDefs);
+    }
 
     std::stringstream vertexStream;
     vertexStream << kGLES1DrawVShaderHeader;
@@ -960,15 +1121,22 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
     vertexStream << GLES1DrawVShaderStateDefs.str();
     vertexStream << kGLES1DrawVShader;
 
-    ANGLE_TRY(
-        compileShader(context, ShaderType::Vertex, vertexStream.str().c_str(), &vertexShader));
+    ANGLE_TRY(compileShader(context, ShaderType::Vertex, vertexStream.str().c_str(),
+                            resultExpectancy, &vertexShader));
 
     std::stringstream GLES1DrawFShaderStateDefs;
-    addFragmentShaderDefs(GLES1DrawFShaderStateDefs);
+    if (isDynamic)
+    {
+        GLES1DrawFShaderStateDefs << kGLES1DrawFShaderDynamicStateDefs;
+    }
+    else
+    {
+        addFragmentShaderDefs(GLES1DrawFShaderStateDefs);
+    }
 
     std::stringstream fragmentStream;
     fragmentStream << kGLES1DrawFShaderVersion;
-    if (mShaderState.mGLES1StateEnabled[GLES1StateEnables::LogicOpThroughFramebufferFetch])
+    if (logicOpThroughFramebufferFetch)
     {
         if (context->getExtensions().shaderFramebufferFetchEXT)
         {
@@ -983,7 +1151,7 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
     fragmentStream << kGLES1TexUnitsDefine << maxTexUnitsEnabled << "u\n";
     fragmentStream << GLES1DrawFShaderStateDefs.str();
     fragmentStream << kGLES1DrawFShaderUniformDefs;
-    if (mShaderState.mGLES1StateEnabled[GLES1StateEnables::LogicOpThroughFramebufferFetch])
+    if (logicOpThroughFramebufferFetch)
     {
         if (context->getExtensions().shaderFramebufferFetchEXT)
         {
@@ -1005,7 +1173,7 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
     fragmentStream << kGLES1DrawFShaderMain;
 
     ANGLE_TRY(compileShader(context, ShaderType::Fragment, fragmentStream.str().c_str(),
-                            &fragmentShader));
+                            resultExpectancy, &fragmentShader));
 
     angle::HashMap<GLint, std::string> attribLocs;
 
@@ -1022,18 +1190,50 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
     }
 
     ANGLE_TRY(linkProgram(context, glState, vertexShader, fragmentShader, attribLocs,
-                          &programState.program));
+                          resultExpectancy, &uberShaderState->programState.program));
+
+    if (resultExpectancy == angle::JobResultExpectancy::Future)
+    {
+        uberShaderState->isLinkPending         = true;
+        uberShaderState->pendingVertexShader   = vertexShader;
+        uberShaderState->pendingFragmentShader = fragmentShader;
+        return angle::Result::Continue;
+    }
 
     mShaderPrograms->deleteShader(context, vertexShader);
     mShaderPrograms->deleteShader(context, fragmentShader);
 
-    Program *programObject        = getProgram(programState.program);
+    return angle::Result::Continue;
+}
+
+angle::Result GLES1Renderer::finishProgramLink(Context *context,
+                                               GLES1UberShaderState *uberShaderState)
+{
+    ASSERT(uberShaderState->isLinkPending);
+    uberShaderState->isLinkPending = false;
+
+    Program *programObject = getProgram(uberShaderState->programState.program);
+    ANGLE_TRY(checkProgramLinked(context, programObject));
+
+    programObject->detachShader(context, getShader(uberShaderState->pendingVertexShader));
+    programObject->detachShader(context, getShader(uberShaderState->pendingFragmentShader));
+    mShaderPrograms->deleteShader(context, uberShaderState->pendingVertexShader);
+    mShaderPrograms->deleteShader(context, uberShaderState->pendingFragmentShader);
+
+    return angle::Result::Continue;
+}
+
+angle::Result GLES1Renderer::initializeProgramState(Context *context,
+                                                    State *glState,
+                                                    GLES1ProgramState *programState)
+{
+    Program *programObject        = getProgram(programState->program);
     ProgramExecutable &executable = programObject->getExecutable();
 
-    programState.projMatrixLoc      = executable.getUniformLocation("projection");
-    programState.modelviewMatrixLoc = executable.getUniformLocation("modelview");
-    programState.textureMatrixLoc   = executable.getUniformLocation("texture_matrix");
-    programState.modelviewInvTrLoc  = executable.getUniformLocation("modelview_invtr");
+    programState->projMatrixLoc      = executable.getUniformLocation("projection");
+    programState->modelviewMatrixLoc = executable.getUniformLocation("modelview");
+    programState->textureMatrixLoc   = executable.getUniformLocation("texture_matrix");
+    programState->modelviewInvTrLoc  = executable.getUniformLocation("modelview_invtr");
 
     for (int i = 0; i < kTexUnitCount; i++)
     {
@@ -1043,76 +1243,180 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
         ss2d << "tex_sampler" << i;
         sscube << "tex_cube_sampler" << i;
 
-        programState.tex2DSamplerLocs[i]   = executable.getUniformLocation(ss2d.str().c_str());
-        programState.texCubeSamplerLocs[i] = executable.getUniformLocation(sscube.str().c_str());
+        programState->tex2DSamplerLocs[i]   = executable.getUniformLocation(ss2d.str().c_str());
+        programState->texCubeSamplerLocs[i] = executable.getUniformLocation(sscube.str().c_str());
     }
 
-    programState.textureEnvColorLoc = executable.getUniformLocation("texture_env_color");
-    programState.rgbScaleLoc        = executable.getUniformLocation("texture_env_rgb_scale");
-    programState.alphaScaleLoc      = executable.getUniformLocation("texture_env_alpha_scale");
+    programState->textureEnvColorLoc = executable.getUniformLocation("texture_env_color");
+    programState->rgbScaleLoc        = executable.getUniformLocation("texture_env_rgb_scale");
+    programState->alphaScaleLoc      = executable.getUniformLocation("texture_env_alpha_scale");
 
-    programState.alphaTestRefLoc = executable.getUniformLocation("alpha_test_ref");
+    programState->alphaTestRefLoc = executable.getUniformLocation("alpha_test_ref");
 
-    programState.materialAmbientLoc  = executable.getUniformLocation("material_ambient");
-    programState.materialDiffuseLoc  = executable.getUniformLocation("material_diffuse");
-    programState.materialSpecularLoc = executable.getUniformLocation("material_specular");
-    programState.materialEmissiveLoc = executable.getUniformLocation("material_emissive");
-    programState.materialSpecularExponentLoc =
+    programState->materialAmbientLoc  = executable.getUniformLocation("material_ambient");
+    programState->materialDiffuseLoc  = executable.getUniformLocation("material_diffuse");
+    programState->materialSpecularLoc = executable.getUniformLocation("material_specular");
+    programState->materialEmissiveLoc = executable.getUniformLocation("material_emissive");
+    programState->materialSpecularExponentLoc =
         executable.getUniformLocation("material_specular_exponent");
 
-    programState.lightModelSceneAmbientLoc =
+    programState->lightModelSceneAmbientLoc =
         executable.getUniformLocation("light_model_scene_ambient");
 
-    programState.lightAmbientsLoc   = executable.getUniformLocation("light_ambients");
-    programState.lightDiffusesLoc   = executable.getUniformLocation("light_diffuses");
-    programState.lightSpecularsLoc  = executable.getUniformLocation("light_speculars");
-    programState.lightPositionsLoc  = executable.getUniformLocation("light_positions");
-    programState.lightDirectionsLoc = executable.getUniformLocation("light_directions");
-    programState.lightSpotlightExponentsLoc =
+    programState->lightAmbientsLoc   = executable.getUniformLocation("light_ambients");
+    programState->lightDiffusesLoc   = executable.getUniformLocation("light_diffuses");
+    programState->lightSpecularsLoc  = executable.getUniformLocation("light_speculars");
+    programState->lightPositionsLoc  = executable.getUniformLocation("light_positions");
+    programState->lightDirectionsLoc = executable.getUniformLocation("light_directions");
+    programState->lightSpotlightExponentsLoc =
         executable.getUniformLocation("light_spotlight_exponents");
-    programState.lightSpotlightCutoffAnglesLoc =
+    programState->lightSpotlightCutoffAnglesLoc =
         executable.getUniformLocation("light_spotlight_cutoff_angles");
-    programState.lightAttenuationConstsLoc =
+    programState->lightAttenuationConstsLoc =
         executable.getUniformLocation("light_attenuation_consts");
-    programState.lightAttenuationLinearsLoc =
+    programState->lightAttenuationLinearsLoc =
         executable.getUniformLocation("light_attenuation_linears");
-    programState.lightAttenuationQuadraticsLoc =
+    programState->lightAttenuationQuadraticsLoc =
         executable.getUniformLocation("light_attenuation_quadratics");
 
-    programState.fogDensityLoc = executable.getUniformLocation("fog_density");
-    programState.fogStartLoc   = executable.getUniformLocation("fog_start");
-    programState.fogEndLoc     = executable.getUniformLocation("fog_end");
-    programState.fogColorLoc   = executable.getUniformLocation("fog_color");
+    programState->fogDensityLoc = executable.getUniformLocation("fog_density");
+    programState->fogStartLoc   = executable.getUniformLocation("fog_start");
+    programState->fogEndLoc     = executable.getUniformLocation("fog_end");
+    programState->fogColorLoc   = executable.getUniformLocation("fog_color");
 
-    programState.clipPlanesLoc = executable.getUniformLocation("clip_planes");
+    programState->clipPlanesLoc = executable.getUniformLocation("clip_planes");
 
-    programState.logicOpLoc = executable.getUniformLocation("logic_op");
+    programState->logicOpLoc = executable.getUniformLocation("logic_op");
 
-    programState.pointSizeMinLoc = executable.getUniformLocation("point_size_min");
-    programState.pointSizeMaxLoc = executable.getUniformLocation("point_size_max");
-    programState.pointDistanceAttenuationLoc =
+    programState->pointSizeMinLoc = executable.getUniformLocation("point_size_min");
+    programState->pointSizeMaxLoc = executable.getUniformLocation("point_size_max");
+    programState->pointDistanceAttenuationLoc =
         executable.getUniformLocation("point_distance_attenuation");
 
-    programState.drawTextureCoordsLoc = executable.getUniformLocation("draw_texture_coords");
-    programState.drawTextureDimsLoc   = executable.getUniformLocation("draw_texture_dims");
-    programState.drawTextureNormalizedCropRectLoc =
+    programState->drawTextureCoordsLoc = executable.getUniformLocation("draw_texture_coords");
+    programState->drawTextureDimsLoc   = executable.getUniformLocation("draw_texture_dims");
+    programState->drawTextureNormalizedCropRectLoc =
         executable.getUniformLocation("draw_texture_normalized_crop_rect");
 
     ANGLE_TRY(glState->setProgram(context, programObject));
 
     for (int i = 0; i < kTexUnitCount; i++)
     {
-        setUniform1i(context, &executable, programState.tex2DSamplerLocs[i], i);
-        setUniform1i(context, &executable, programState.texCubeSamplerLocs[i], i + kTexUnitCount);
+        setUniform1i(context, &executable, programState->tex2DSamplerLocs[i], i);
+        setUniform1i(context, &executable, programState->texCubeSamplerLocs[i], i + kTexUnitCount);
     }
 
-    // We just created a new program, we need to sync everything
-    gles1State->setAllDirty();
+    return angle::Result::Continue;
+}
+
+angle::Result GLES1Renderer::useDynamicProgram(Context *context,
+                                               State *glState,
+                                               GLES1State *gles1State)
+{
+    ASSERT(!mShaderState.mGLES1StateEnabled[GLES1StateEnables::LogicOpThroughFramebufferFetch]);
+
+    GLES1ProgramState &programState = mDynamicProgramState.programState;
+    mUseDynamicProgram              = true;
+
+    if (!mDynamicProgramInitialized)
+    {
+        ANGLE_TRY(createProgram(context, glState, true, angle::JobResultExpectancy::Immediate,
+                                &mDynamicProgramState));
+        ANGLE_TRY(initializeProgramState(context, glState, &programState));
+
+        ProgramExecutable &executable = getProgram(programState.program)->getExecutable();
+
+        for (const DynamicStateEnable &enable : kDynamicStateEnables)
+        {
+            mDynamicStateLocations.enableLocs.push_back(
+                executable.getUniformLocation(enable.name));
+        }
+        for (const DynamicStateBoolTexArray &boolTexArray : kDynamicStateBoolTexArrays)
+        {
+            mDynamicStateLocations.boolTexArrayLocs.push_back(
+                executable.getUniformLocation(boolTexArray.name));
+        }
+        for (const DynamicStateUintTexArray &uintTexArray : kDynamicStateUintTexArrays)
+        {
+            mDynamicStateLocations.uintTexArrayLocs.push_back(
+                executable.getUniformLocation(uintTexArray.name));
+        }
+        mDynamicStateLocations.lightEnablesLoc = executable.getUniformLocation("light_enables");
+        mDynamicStateLocations.clipPlaneEnablesLoc =
+            executable.getUniformLocation("clip_plane_enables");
+        mDynamicStateLocations.alphaFuncLoc = executable.getUniformLocation("alpha_func");
+        mDynamicStateLocations.fogModeLoc   = executable.getUniformLocation("fog_mode");
+
+        setDynamicProgramState(context, &executable);
+
+        mDynamicProgramInitialized = true;
+        gles1State->setAllDirty();
+        return angle::Result::Continue;
+    }
+
+    Program *programObject = getProgram(programState.program);
+    if (glState->getProgram()->id() != programObject->id())
+    {
+        gles1State->setAllDirty();
+    }
+    ANGLE_TRY(glState->setProgram(context, programObject));
+
+    if (mDynamicProgramShaderState != mShaderState)
+    {
+        setDynamicProgramState(context, &programObject->getExecutable());
+    }
 
-    mRendererProgramInitialized = true;
     return angle::Result::Continue;
 }
 
+void GLES1Renderer::setDynamicProgramState(Context *context, ProgramExecutable *executable)
+{
+    for (size_t index = 0; index < std::size(kDynamicStateEnables); ++index)
+    {
+        const GLES1StateEnables state = kDynamicStateEnables[index].state;
+        setUniform1i(context, executable, mDynamicStateLocations.enableLocs[index],
+                     mShaderState.mGLES1StateEnabled.test(state));
+    }
+
+    for (size_t index = 0; index < std::size(kDynamicStateBoolTexArrays); ++index)
+    {
+        const GLES1ShaderState::BoolTexArray &values =
+            mShaderState.*kDynamicStateBoolTexArrays[index].member;
+        std::array<GLint, kTexUnitCount> intValues;
+        std::copy(std::begin(values), std::end(values), intValues.begin());
+        setUniform1iv(context, executable, mDynamicStateLocations.boolTexArrayLocs[index],
+                      kTexUnitCount, intValues.data());
+    }
+
+    for (size_t index = 0; index < std::size(kDynamicStateUintTexArrays); ++index)
+    {
+        const GLES1ShaderState::UintTexArray &values =
+            mShaderState.*kDynamicStateUintTexArrays[index].member;
+        std::array<GLuint, kTexUnitCount> uintValues;
+        std::copy(std::begin(values), std::end(values), uintValues.begin());
+        setUniform1uiv(executable, mDynamicStateLocations.uintTexArrayLocs[index], kTexUnitCount,
+                       uintValues.data());
+    }
+
+    std::array<GLint, kLightCount> lightEnables;
+    std::copy(std::begin(mShaderState.lightEnables), std::end(mShaderState.lightEnables),
+              lightEnables.begin());
+    setUniform1iv(context, executable, mDynamicStateLocations.lightEnablesLoc, kLightCount,
+                  lightEnables.data());
+
+    std::array<GLint, kClipPlaneCount> clipPlaneEnables;
+    std::copy(std::begin(mShaderState.clipPlaneEnables), std::end(mShaderState.clipPlaneEnables),
+              clipPlaneEnables.begin());
+    setUniform1iv(context, executable, mDynamicStateLocations.clipPlaneEnablesLoc,
+                  kClipPlaneCount, clipPlaneEnables.data());
+
+    setUniform1ui(executable, mDynamicStateLocations.alphaFuncLoc,
+                  ToGLenum(mShaderState.alphaTestFunc));
+    setUniform1ui(executable, mDynamicStateLocations.fogModeLoc, ToGLenum(mShaderState.fogMode));
+
+    mDynamicProgramShaderState = mShaderState;
+}
+
 void GLES1Renderer::setUniform1i(Context *context,
                                  ProgramExecutable *executable,
                                  UniformLocation location,
@@ -1132,6 +1436,16 @@ void GLES1Renderer::setUniform1ui(ProgramExecutable *executable,
     executable->setUniform1uiv(location, 1, &value);
 }
 
+void GLES1Renderer::setUniform1uiv(ProgramExecutable *executable,
+                                   UniformLocation location,
+                                   GLint count,
+                                   const GLuint *value)
+{
+    if (location.value == -1)
+        return;
+    executable->setUniform1uiv(location, count, value);
+}
+
 void GLES1Renderer::setUniform1iv(Context *context,
                                   ProgramExecutable *executable,
                                   UniformLocation location,
@@ -19,6 +19,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace gl
 {
@@ -156,22 +157,31 @@ class GLES1Renderer final : angle::NonCopyable
     angle::Result compileShader(Context *context,
                                 ShaderType shaderType,
                                 const char *src,
+                                angle::JobResultExpectancy resultExpectancy,
                                 ShaderProgramID *shaderOut);
     angle::Result linkProgram(Context *context,
                               State *glState,
                               ShaderProgramID vshader,
                               ShaderProgramID fshader,
                               const angle::HashMap<GLint, std::string> &attribLocs,
+                              angle::JobResultExpectancy resultExpectancy,
                               ShaderProgramID *programOut);
+    angle::Result checkProgramLinked(Context *context, Program *programObject);
     angle::Result initializeRendererProgram(Context *context,
                                             State *glState,
                                             GLES1State *gles1State);
+    angle::Result useDynamicProgram(Context *context, State *glState, GLES1State *gles1State);
+    void setDynamicProgramState(Context *context, ProgramExecutable *executable);
 
     void setUniform1i(Context *context,
                       ProgramExecutable *executable,
                       UniformLocation location,
                       GLint value);
     void setUniform1ui(ProgramExecutable *executable, UniformLocation location, GLuint value);
+    void setUniform1uiv(ProgramExecutable *executable,
+                        UniformLocation location,
+                        GLint count,
+                        const GLuint *value);
     void setUniform1iv(Context *context,
                        ProgramExecutable *executable,
                        UniformLocation location,
@@ -332,16 +342,60 @@ class GLES1Renderer final : angle::NonCopyable
     {
         GLES1UniformBuffers uniformBuffers;
         GLES1ProgramState programState;
+        // Set while the program is being linked in the background, along with the shaders to
+        // release once the link is done.  The dynamic program is used in the meantime.
+        bool isLinkPending = false;
+        ShaderProgramID pendingVertexShader;
+        ShaderProgramID pendingFragmentShader;
     };
 
+    // Locations of the uniforms that replace the shader state constants in the dynamic program.
+    // Ordered as the corresponding tables in GLES1Renderer.cpp.
+    struct GLES1DynamicStateLocations
+    {
+        std::vector<UniformLocation> enableLocs;
+        std::vector<UniformLocation> boolTexArrayLocs;
+        std::vector<UniformLocation> uintTexArrayLocs;
+        UniformLocation lightEnablesLoc;
+        UniformLocation clipPlaneEnablesLoc;
+        UniformLocation alphaFuncLoc;
+        UniformLocation fogModeLoc;
+    };
+
+    // Generates, compiles and links either the program specialized for |mShaderState|, or the
+    // dynamic program that takes that state from uniforms.  With a |Future| result expectancy,
+    // the program is left linking in the background until |finishProgramLink| is called.
+    angle::Result createProgram(Context *context,
+                                State *glState,
+                                bool isDynamic,
+                                angle::JobResultExpectancy resultExpectancy,
+                                GLES1UberShaderState *uberShaderState);
+    angle::Result finishProgramLink(Context *context, GLES1UberShaderState *uberShaderState);
+    angle::Result initializeProgramState(Context *context,
+                                         State *glState,
+                                         GLES1ProgramState *programState);
+
     GLES1UberShaderState &getUberShaderState()
     {
+        if (mUseDynamicProgram)
+        {
+            return mDynamicProgramState;
+        }
         ASSERT(mUberShaderState.find(mShaderState) != mUberShaderState.end());
         return mUberShaderState[mShaderState];
     }
 
     angle::HashMap<GLES1ShaderState, GLES1UberShaderState> mUberShaderState;
 
+    // The program that implements every shader state dynamically, created on first need if
+    // specialized programs are linked in the background.
+    bool mDynamicProgramInitialized = false;
+    bool mUseDynamicProgram         = false;
+    GLES1UberShaderState mDynamicProgramState;
+    GLES1DynamicStateLocations mDynamicStateLocations;
+    // The shader state last set in the uniforms of the dynamic program.
+    GLES1ShaderState mDynamicProgramShaderState;
+
     bool mDrawTextureEnabled      = false;
     GLfloat mDrawTextureCoords[4] = {0.0f, 0.0f, 0.0f, 0.0f};
     GLfloat mDrawTextureDims[2]   = {0.0f, 0.0f};
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <limits>
 
 #include "common/debug.h"
@@ -96,20 +97,34 @@ void HandleAllocator::release(GLuint handle)
         WARN() << "HandleAllocator::release releasing " << handle << std::endl;
     }
 
-    // Try consolidating the ranges first.
-    for (HandleRange &handleRange : mUnallocatedList)
+    // Try consolidating the ranges first.  The ranges are sorted and disjoint, so only the first
+    // range after |handle| and the one before it can be adjacent to it.
+    auto nextIt = std::lower_bound(mUnallocatedList.begin(), mUnallocatedList.end(), handle,
+                                   HandleRangeComparator());
+    ASSERT(nextIt == mUnallocatedList.end() || nextIt->begin > handle);
+
+    const bool adjacentToNext = nextIt != mUnallocatedList.end() && nextIt->begin - 1 == handle;
+    const bool adjacentToPrev =
+        nextIt != mUnallocatedList.begin() && std::prev(nextIt)->end + 1 == handle;
+
+    if (adjacentToPrev && adjacentToNext)
     {
-        if (handleRange.begin - 1 == handle)
-        {
-            handleRange.begin--;
-            return;
-        }
+        // The handle fills the gap between two ranges; merge them to avoid fragmenting the list.
+        std::prev(nextIt)->end = nextIt->end;
+        mUnallocatedList.erase(nextIt);
+        return;
+    }
 
-        if (handleRange.end == handle - 1)
-        {
-            handleRange.end++;
-            return;
-        }
+    if (adjacentToNext)
+    {
+        nextIt->begin--;
+        return;
+    }
+
+    if (adjacentToPrev)
+    {
+        std::prev(nextIt)->end++;
+        return;
     }
 
     // Add to released list, logarithmic time for push_heap.
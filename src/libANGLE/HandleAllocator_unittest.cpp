@@ -243,4 +243,35 @@ TEST(HandleAllocatorTest, ConsolidateRangeDuringRelease)
     EXPECT_NE(handle, static_cast<GLuint>(-1));
 }
 
+// Tests that releasing handles which were reserved in the middle of the unallocated ranges
+// consolidates the ranges again, and allocation continues in sorted order.
+TEST(HandleAllocatorTest, ReleaseReservedHandlesConsolidatesRanges)
+{
+    constexpr GLuint kHandleCount = 1000;
+
+    gl::HandleAllocator allocator;
+
+    // Split the unallocated range at every odd handle.
+    for (GLuint handle = 1; handle <= kHandleCount; handle += 2)
+    {
+        allocator.reserve(handle);
+    }
+
+    // Release in an order that exercises merging with the previous range, the next range, and
+    // both at once.
+    for (GLuint handle = 3; handle <= kHandleCount; handle += 4)
+    {
+        allocator.release(handle);
+    }
+    for (GLuint handle = 1; handle <= kHandleCount; handle += 4)
+    {
+        allocator.release(handle);
+    }
+
+    for (GLuint handle = 1; handle <= kHandleCount + 10; ++handle)
+    {
+        EXPECT_EQ(handle, allocator.allocate());
+    }
+}
+
 }  // anonymous namespace
@@ -2286,7 +2286,11 @@ bool Program::deserialize(const Context *context, BinaryInputStream &stream)
     // mSeparable must be before mExecutable->load(), since it uses the value.  This state is
     // duplicated in the executable for convenience.
     mState.mExecutable->mPod.isSeparable = mState.mSeparable;
-    mState.mExecutable->load(&stream);
+    if (!mState.mExecutable->load(&stream))
+    {
+        mState.mInfoLog << "Invalid program binary.";
+        return false;
+    }
 
     static_assert(static_cast<unsigned long>(ShaderType::EnumCount) <= sizeof(unsigned long) * 8,
                   "Too many shader types");
@@ -2326,6 +2330,8 @@ bool Program::deserialize(const Context *context, BinaryInputStream &stream)
 
 void Program::postResolveLink(const Context *context)
 {
+    mState.mExecutable->buildResourceNameIndex();
+
     mState.updateActiveSamplers();
     mState.mExecutable->mActiveImageShaderBits.fill({});
     mState.mExecutable->updateActiveImages(getExecutable());
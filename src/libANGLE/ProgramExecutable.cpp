@@ -255,26 +255,19 @@ void LoadProgramInputs(BinaryInputStream *stream, std::vector<ProgramInput> *pro
 void SaveUniforms(BinaryOutputStream *stream,
                   const std::vector<LinkedUniform> &uniforms,
                   const std::vector<std::string> &uniformNames,
-                  const std::vector<std::string> &uniformMappedNames,
                   const std::vector<VariableLocation> &uniformLocations)
 {
     stream->writeVector(uniforms);
     ASSERT(uniforms.size() == uniformNames.size());
-    ASSERT(uniforms.size() == uniformMappedNames.size());
     for (const std::string &name : uniformNames)
     {
         stream->writeString(name);
     }
-    for (const std::string &name : uniformMappedNames)
-    {
-        stream->writeString(name);
-    }
     stream->writeVector(uniformLocations);
 }
 void LoadUniforms(BinaryInputStream *stream,
                   std::vector<LinkedUniform> *uniforms,
                   std::vector<std::string> *uniformNames,
-                  std::vector<std::string> *uniformMappedNames,
                   std::vector<VariableLocation> *uniformLocations)
 {
     stream->readVector(uniforms);
@@ -285,11 +278,6 @@ void LoadUniforms(BinaryInputStream *stream,
         {
             stream->readString(&(*uniformNames)[uniformIndex]);
         }
-        uniformMappedNames->resize(uniforms->size());
-        for (size_t uniformIndex = 0; uniformIndex < uniforms->size(); ++uniformIndex)
-        {
-            stream->readString(&(*uniformMappedNames)[uniformIndex]);
-        }
     }
     stream->readVector(uniformLocations);
 }
@@ -325,6 +313,71 @@ void LoadBufferVariable(BinaryInputStream *stream, BufferVariable *var)
     stream->readStruct(&var->pod);
 }
 
+// The uniform mapped names are only used by the GL, D3D and Metal backends, and buffer variables
+// only by program interface queries.  They are serialized in their own section, which is decoded
+// lazily.
+void SaveLazyReflection(BinaryOutputStream *stream,
+                        const std::vector<std::string> &uniformMappedNames,
+                        const std::vector<BufferVariable> &bufferVariables)
+{
+    for (const std::string &name : uniformMappedNames)
+    {
+        stream->writeString(name);
+    }
+
+    stream->writeInt(bufferVariables.size());
+    for (const BufferVariable &bufferVariable : bufferVariables)
+    {
+        WriteBufferVariable(stream, bufferVariable);
+    }
+}
+
+void LoadLazyReflection(BinaryInputStream *stream,
+                        size_t uniformCount,
+                        std::vector<std::string> *uniformMappedNames,
+                        std::vector<BufferVariable> *bufferVariables)
+{
+    uniformMappedNames->resize(uniformCount);
+    for (std::string &name : *uniformMappedNames)
+    {
+        stream->readString(&name);
+    }
+
+    bufferVariables->resize(stream->readInt<size_t>());
+    for (BufferVariable &bufferVariable : *bufferVariables)
+    {
+        LoadBufferVariable(stream, &bufferVariable);
+    }
+}
+
+// Checks that the lazy reflection section has exactly the layout LoadLazyReflection expects,
+// without decoding it, so a malformed binary fails to load instead of failing on first access.
+bool ValidateLazyReflection(const std::vector<uint8_t> &lazyReflection, size_t uniformCount)
+{
+    BinaryInputStream stream(lazyReflection.data(), lazyReflection.size());
+    for (size_t uniformIndex = 0; uniformIndex < uniformCount && !stream.error(); ++uniformIndex)
+    {
+        stream.skip(stream.readInt<size_t>());
+    }
+
+    // Each buffer variable takes at least the lengths of its two names and its POD struct.
+    constexpr size_t kMinBufferVariableSize = 2 * sizeof(size_t) + sizeof(BufferVariable::pod);
+    const size_t bufferVariableCount        = stream.readInt<size_t>();
+    if (stream.error() || bufferVariableCount > stream.remainingSize() / kMinBufferVariableSize)
+    {
+        return false;
+    }
+
+    for (size_t index = 0; index < bufferVariableCount && !stream.error(); ++index)
+    {
+        stream.skip(stream.readInt<size_t>());
+        stream.skip(stream.readInt<size_t>());
+        stream.skip(sizeof(BufferVariable::pod));
+    }
+
+    return !stream.error() && stream.endOfStream();
+}
+
 void WriteAtomicCounterBuffer(BinaryOutputStream *stream, const AtomicCounterBuffer &var)
 {
     stream->writeVector(var.memberIndexes);
@@ -541,13 +594,13 @@ GLint GetUniformLocation(const std::vector<LinkedUniform> &uniformList,
     return -1;
 }
 
-GLuint GetInterfaceBlockIndex(const std::vector<InterfaceBlock> &list, const std::string &name)
+GLuint FindInterfaceBlockIndex(const std::vector<InterfaceBlock> &list,
+                               const std::string &baseName,
+                               const std::vector<unsigned int> &subscripts,
+                               unsigned int firstBlockIndex)
 {
-    std::vector<unsigned int> subscripts;
-    std::string baseName = ParseResourceName(name, &subscripts);
-
     unsigned int numBlocks = static_cast<unsigned int>(list.size());
-    for (unsigned int blockIndex = 0; blockIndex < numBlocks; blockIndex++)
+    for (unsigned int blockIndex = firstBlockIndex; blockIndex < numBlocks; blockIndex++)
     {
         const auto &block = list[blockIndex];
         if (block.name == baseName)
@@ -566,6 +619,14 @@ GLuint GetInterfaceBlockIndex(const std::vector<InterfaceBlock> &list, const std
     return GL_INVALID_INDEX;
 }
 
+GLuint GetInterfaceBlockIndex(const std::vector<InterfaceBlock> &list, const std::string &name)
+{
+    std::vector<unsigned int> subscripts;
+    std::string baseName = ParseResourceName(name, &subscripts);
+
+    return FindInterfaceBlockIndex(list, baseName, subscripts, 0);
+}
+
 void GetInterfaceBlockName(const UniformBlockIndex index,
                            const std::vector<InterfaceBlock> &list,
                            GLsizei bufSize,
@@ -838,8 +899,12 @@ void ProgramExecutable::reset()
     mUniforms.clear();
     mUniformNames.clear();
     mUniformMappedNames.clear();
+    mLazyReflection.clear();
+    mLazyReflectionDecoded.store(true, std::memory_order_relaxed);
     mUniformBlocks.clear();
     mUniformLocations.clear();
+    mUniformsByName.clear();
+    mUniformBlocksByName.clear();
     mShaderStorageBlocks.clear();
     mAtomicCounterBuffers.clear();
     mBufferVariables.clear();
@@ -855,7 +920,7 @@ void ProgramExecutable::reset()
     mPostLinkSubTaskWaitableEvents.clear();
 }
 
-void ProgramExecutable::load(gl::BinaryInputStream *stream)
+bool ProgramExecutable::load(gl::BinaryInputStream *stream)
 {
     static_assert(MAX_VERTEX_ATTRIBS * 2 <= sizeof(uint32_t) * 8,
                   "Too many vertex attribs for mask: All bits of mAttributesTypeMask types and "
@@ -867,7 +932,7 @@ void ProgramExecutable::load(gl::BinaryInputStream *stream)
     stream->readStruct(&mPod);
 
     LoadProgramInputs(stream, &mProgramInputs);
-    LoadUniforms(stream, &mUniforms, &mUniformNames, &mUniformMappedNames, &mUniformLocations);
+    LoadUniforms(stream, &mUniforms, &mUniformNames, &mUniformLocations);
 
     size_t uniformBlockCount = stream->readInt<size_t>();
     ASSERT(getUniformBlocks().empty());
@@ -897,13 +962,14 @@ void ProgramExecutable::load(gl::BinaryInputStream *stream)
         LoadAtomicCounterBuffer(stream, &atomicCounterBuffer);
     }
 
-    size_t bufferVariableCount = stream->readInt<size_t>();
-    ASSERT(getBufferVariables().empty());
-    mBufferVariables.resize(bufferVariableCount);
-    for (size_t bufferVarIndex = 0; bufferVarIndex < bufferVariableCount; ++bufferVarIndex)
+    // Most programs never need the lazy reflection, so it's only decoded on first access.
+    ASSERT(mUniformMappedNames.empty() && mBufferVariables.empty());
+    stream->readVector(&mLazyReflection);
+    if (!ValidateLazyReflection(mLazyReflection, mUniforms.size()))
     {
-        LoadBufferVariable(stream, &mBufferVariables[bufferVarIndex]);
+        return false;
     }
+    mLazyReflectionDecoded.store(false, std::memory_order_release);
 
     size_t transformFeedbackVaryingCount = stream->readInt<size_t>();
     ASSERT(mLinkedTransformFeedbackVaryings.empty());
@@ -984,6 +1050,8 @@ void ProgramExecutable::load(gl::BinaryInputStream *stream)
             }
         }
     }
+
+    return true;
 }
 
 void ProgramExecutable::save(gl::BinaryOutputStream *stream) const
@@ -998,7 +1066,7 @@ void ProgramExecutable::save(gl::BinaryOutputStream *stream) const
     stream->writeStruct(mPod);
 
     SaveProgramInputs(stream, mProgramInputs);
-    SaveUniforms(stream, mUniforms, mUniformNames, mUniformMappedNames, mUniformLocations);
+    SaveUniforms(stream, mUniforms, mUniformNames, mUniformLocations);
 
     stream->writeInt(getUniformBlocks().size());
     for (const InterfaceBlock &uniformBlock : getUniformBlocks())
@@ -1018,10 +1086,19 @@ void ProgramExecutable::save(gl::BinaryOutputStream *stream) const
         WriteAtomicCounterBuffer(stream, atomicCounterBuffer);
     }
 
-    stream->writeInt(getBufferVariables().size());
-    for (const BufferVariable &bufferVariable : getBufferVariables())
     {
-        WriteBufferVariable(stream, bufferVariable);
+        std::lock_guard<angle::SimpleMutex> lock(mLazyReflectionMutex);
+        if (!mLazyReflectionDecoded.load(std::memory_order_relaxed))
+        {
+            // Still in its serialized form; there's no need to decode it.
+            stream->writeVector(mLazyReflection);
+        }
+        else
+        {
+            BinaryOutputStream lazyReflectionStream;
+            SaveLazyReflection(&lazyReflectionStream, mUniformMappedNames, mBufferVariables);
+            stream->writeVector(lazyReflectionStream.getData());
+        }
     }
 
     stream->writeInt(getLinkedTransformFeedbackVaryings().size());
@@ -1092,6 +1169,32 @@ void ProgramExecutable::save(gl::BinaryOutputStream *stream) const
     }
 }
 
+void ProgramExecutable::decodeLazyReflection() const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mLazyReflectionMutex);
+    if (mLazyReflectionDecoded.load(std::memory_order_relaxed))
+    {
+        // Another thread decoded it while this one was waiting for the lock.
+        return;
+    }
+
+    BinaryInputStream stream(mLazyReflection.data(), mLazyReflection.size());
+    LoadLazyReflection(&stream, mUniforms.size(), &mUniformMappedNames, &mBufferVariables);
+
+    // The section is validated by load(), so this is not expected.  Don't leave partially decoded
+    // reflection behind.
+    if (ANGLE_UNLIKELY(stream.error() || !stream.endOfStream()))
+    {
+        UNREACHABLE();
+        mUniformMappedNames.clear();
+        mBufferVariables.clear();
+    }
+
+    mLazyReflection.clear();
+    mLazyReflection.shrink_to_fit();
+    mLazyReflectionDecoded.store(true, std::memory_order_release);
+}
+
 std::string ProgramExecutable::getInfoLogString() const
 {
     return mInfoLog->str();
@@ -2248,8 +2351,7 @@ void ProgramExecutable::getBufferVariableResourceName(GLuint index,
                                                       GLsizei *length,
                                                       GLchar *name) const
 {
-    ASSERT(index < mBufferVariables.size());
-    getResourceName(mBufferVariables[index].name, bufSize, length, name);
+    getResourceName(getBufferVariableByIndex(index).name, bufSize, length, name);
 }
 
 const std::string ProgramExecutable::getInputResourceName(GLuint index) const
@@ -2506,7 +2608,49 @@ const VariableLocation &ProgramExecutable::getUniformLocation(UniformLocation lo
 
 UniformLocation ProgramExecutable::getUniformLocation(const std::string &name) const
 {
-    return {GetUniformLocation(mUniforms, mUniformNames, mUniformLocations, name)};
+    if (mUniformsByName.empty())
+    {
+        return {GetUniformLocation(mUniforms, mUniformNames, mUniformLocations, name)};
+    }
+
+    // The exact name of a uniform, or the base name of an array uniform, refers to element 0.
+    GLint location = -1;
+    auto iter      = mUniformsByName.find(name);
+    if (iter != mUniformsByName.end())
+    {
+        location = iter->second.firstLocation;
+    }
+
+    // A subscripted name refers to that element of an array uniform.  Elements usually occupy
+    // consecutive locations; if they don't, fall back to the linear search.
+    size_t nameLengthWithoutArrayIndex;
+    unsigned int arrayIndex = ParseArrayIndex(name, &nameLengthWithoutArrayIndex);
+    if (nameLengthWithoutArrayIndex < name.length())
+    {
+        auto arrayIter = mUniformsByName.find(name.substr(0, nameLengthWithoutArrayIndex));
+        if (arrayIter != mUniformsByName.end() &&
+            mUniforms[arrayIter->second.uniformIndex].isArray() &&
+            arrayIndex < mUniforms[arrayIter->second.uniformIndex].getBasicTypeElementCount())
+        {
+            const UniformNameIndexEntry &entry = arrayIter->second;
+            const size_t elementLocation = static_cast<size_t>(entry.firstLocation) + arrayIndex;
+            if (entry.firstLocation < 0 || elementLocation >= mUniformLocations.size() ||
+                !mUniformLocations[elementLocation].used() ||
+                mUniformLocations[elementLocation].index != entry.uniformIndex ||
+                mUniformLocations[elementLocation].arrayIndex != arrayIndex)
+            {
+                return {GetUniformLocation(mUniforms, mUniformNames, mUniformLocations, name)};
+            }
+
+            // The linear search returns whichever match has the lowest location.
+            if (location < 0 || static_cast<GLint>(elementLocation) < location)
+            {
+                location = static_cast<GLint>(elementLocation);
+            }
+        }
+    }
+
+    return {location};
 }
 
 GLuint ProgramExecutable::getUniformIndex(const std::string &name) const
@@ -2524,12 +2668,35 @@ bool ProgramExecutable::shouldIgnoreUniform(UniformLocation location) const
 
 GLuint ProgramExecutable::getUniformIndexFromName(const std::string &name) const
 {
-    return GetUniformIndexFromName(mUniforms, mUniformNames, name);
+    if (mUniformsByName.empty())
+    {
+        return GetUniformIndexFromName(mUniforms, mUniformNames, name);
+    }
+
+    // Either the exact name, the base name of an array uniform, or the name of an array uniform.
+    GLuint index = GL_INVALID_INDEX;
+    auto iter    = mUniformsByName.find(name);
+    if (iter != mUniformsByName.end())
+    {
+        index = iter->second.uniformIndex;
+    }
+
+    if (angle::EndsWith(name, "[0]"))
+    {
+        auto arrayIter = mUniformsByName.find(name.substr(0, name.length() - 3));
+        if (arrayIter != mUniformsByName.end() &&
+            mUniforms[arrayIter->second.uniformIndex].isArray())
+        {
+            index = std::min(index, arrayIter->second.uniformIndex);
+        }
+    }
+
+    return index;
 }
 
 GLuint ProgramExecutable::getBufferVariableIndexFromName(const std::string &name) const
 {
-    return GetResourceIndexFromName(mBufferVariables, name);
+    return GetResourceIndexFromName(getBufferVariables(), name);
 }
 
 GLuint ProgramExecutable::getUniformIndexFromLocation(UniformLocation location) const
@@ -2600,7 +2767,21 @@ GLint ProgramExecutable::getActiveShaderStorageBlockMaxNameLength() const
 
 GLuint ProgramExecutable::getUniformBlockIndex(const std::string &name) const
 {
-    return GetInterfaceBlockIndex(mUniformBlocks, name);
+    if (mUniformBlocksByName.empty())
+    {
+        return GetInterfaceBlockIndex(mUniformBlocks, name);
+    }
+
+    std::vector<unsigned int> subscripts;
+    std::string baseName = ParseResourceName(name, &subscripts);
+
+    // Only the first block with this name is indexed; the elements of a block array follow it.
+    auto iter = mUniformBlocksByName.find(baseName);
+    if (iter == mUniformBlocksByName.end())
+    {
+        return GL_INVALID_INDEX;
+    }
+    return FindInterfaceBlockIndex(mUniformBlocks, baseName, subscripts, iter->second);
 }
 
 GLuint ProgramExecutable::getShaderStorageBlockIndex(const std::string &name) const
@@ -2608,6 +2789,44 @@ GLuint ProgramExecutable::getShaderStorageBlockIndex(const std::string &name) co
     return GetInterfaceBlockIndex(mShaderStorageBlocks, name);
 }
 
+void ProgramExecutable::buildResourceNameIndex()
+{
+    mUniformsByName.clear();
+    mUniformBlocksByName.clear();
+
+    // Only one name is stored per uniform and per uniform block, so the index stays small even
+    // for programs with large arrays.  Array subscripts are parsed when looking up.
+    std::vector<GLint> firstLocations(mUniforms.size(), -1);
+    for (size_t location = 0; location < mUniformLocations.size(); ++location)
+    {
+        const VariableLocation &variableLocation = mUniformLocations[location];
+        if (variableLocation.used() && variableLocation.arrayIndex == 0 &&
+            firstLocations[variableLocation.index] < 0)
+        {
+            firstLocations[variableLocation.index] = static_cast<GLint>(location);
+        }
+    }
+
+    mUniformsByName.reserve(mUniformNames.size());
+    for (size_t index = 0; index < mUniformNames.size(); ++index)
+    {
+        // Names of array uniforms end in [0]; they are indexed by their base name.
+        const std::string &uniformName = mUniformNames[index];
+        const size_t keyLength = mUniforms[index].isArray() && angle::EndsWith(uniformName, "[0]")
+                                     ? uniformName.length() - 3
+                                     : uniformName.length();
+        mUniformsByName.emplace(uniformName.substr(0, keyLength),
+                                UniformNameIndexEntry{static_cast<GLuint>(index),
+                                                      firstLocations[index]});
+    }
+
+    for (size_t blockIndex = 0; blockIndex < mUniformBlocks.size(); ++blockIndex)
+    {
+        mUniformBlocksByName.emplace(mUniformBlocks[blockIndex].name,
+                                     static_cast<GLuint>(blockIndex));
+    }
+}
+
 GLuint ProgramExecutable::getSamplerUniformBinding(const VariableLocation &uniformLocation) const
 {
     GLuint samplerIndex                  = getSamplerIndexFromUniformIndex(uniformLocation.index);
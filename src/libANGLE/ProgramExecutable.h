@@ -10,6 +10,8 @@
 #define LIBANGLE_PROGRAMEXECUTABLE_H_
 
 #include "common/BinaryStream.h"
+#include "common/SimpleMutex.h"
+#include "common/hash_containers.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/InfoLog.h"
 #include "libANGLE/ProgramLinkedResources.h"
@@ -247,7 +249,8 @@ class ProgramExecutable final : public angle::Subject
     ANGLE_INLINE rx::ProgramExecutableImpl *getImplementation() const { return mImplementation; }
 
     void save(gl::BinaryOutputStream *stream) const;
-    void load(gl::BinaryInputStream *stream);
+    // Returns false if the binary is malformed.
+    bool load(gl::BinaryInputStream *stream);
 
     InfoLog &getInfoLog() const { return *mInfoLog; }
     std::string getInfoLogString() const;
@@ -360,7 +363,11 @@ class ProgramExecutable final : public angle::Subject
     }
     const std::vector<LinkedUniform> &getUniforms() const { return mUniforms; }
     const std::vector<std::string> &getUniformNames() const { return mUniformNames; }
-    const std::vector<std::string> &getUniformMappedNames() const { return mUniformMappedNames; }
+    const std::vector<std::string> &getUniformMappedNames() const
+    {
+        materializeLazyReflection();
+        return mUniformMappedNames;
+    }
     const std::vector<InterfaceBlock> &getUniformBlocks() const { return mUniformBlocks; }
     const std::vector<VariableLocation> &getUniformLocations() const { return mUniformLocations; }
     const std::vector<SamplerBinding> &getSamplerBindings() const { return mSamplerBindings; }
@@ -430,6 +437,7 @@ class ProgramExecutable final : public angle::Subject
     }
     const BufferVariable &getBufferVariableByIndex(size_t index) const
     {
+        materializeLazyReflection();
         ASSERT(index < mBufferVariables.size());
         return mBufferVariables[index];
     }
@@ -445,7 +453,11 @@ class ProgramExecutable final : public angle::Subject
     {
         return mShaderStorageBlocks;
     }
-    const std::vector<BufferVariable> &getBufferVariables() const { return mBufferVariables; }
+    const std::vector<BufferVariable> &getBufferVariables() const
+    {
+        materializeLazyReflection();
+        return mBufferVariables;
+    }
     const LinkedUniform &getUniformByIndex(size_t index) const
     {
         ASSERT(index < static_cast<size_t>(mUniforms.size()));
@@ -629,6 +641,11 @@ class ProgramExecutable final : public angle::Subject
     GLuint getUniformBlockIndex(const std::string &name) const;
     GLuint getShaderStorageBlockIndex(const std::string &name) const;
 
+    // Builds the hashed name lookup used by getUniformLocation, getUniformIndexFromName and
+    // getUniformBlockIndex.  Must be called once the uniform locations are final, i.e. after the
+    // backend has marked the unused ones.
+    void buildResourceNameIndex();
+
     GLuint getUniformIndexFromName(const std::string &name) const;
     GLuint getUniformIndexFromLocation(UniformLocation location) const;
     Optional<GLuint> getSamplerIndex(UniformLocation location) const;
@@ -757,6 +774,16 @@ class ProgramExecutable final : public angle::Subject
 
     void reset();
 
+    // Decodes mLazyReflection into the mutable members below the first time they are accessed.
+    void materializeLazyReflection() const
+    {
+        if (ANGLE_UNLIKELY(!mLazyReflectionDecoded.load(std::memory_order_acquire)))
+        {
+            decodeLazyReflection();
+        }
+    }
+    void decodeLazyReflection() const;
+
     void updateActiveImages(const ProgramExecutable &executable);
 
     bool linkMergedVaryings(const Caps &caps,
@@ -969,14 +996,39 @@ class ProgramExecutable final : public angle::Subject
     // [0] in the end. This makes implementation of queries simpler.
     std::vector<LinkedUniform> mUniforms;
     std::vector<std::string> mUniformNames;
-    // Only used by GL and D3D backend
-    std::vector<std::string> mUniformMappedNames;
+    // Only used by the GL, D3D and Metal backends.  Lazily decoded from mLazyReflection after
+    // load().
+    mutable std::vector<std::string> mUniformMappedNames;
     std::vector<InterfaceBlock> mUniformBlocks;
     std::vector<VariableLocation> mUniformLocations;
 
+    // Uniforms and uniform blocks by name, to speed up the name queries.  Array uniforms are keyed
+    // by their base name, with the location of element 0.  Not serialized; rebuilt from the above
+    // when the link is resolved.
+    struct UniformNameIndexEntry
+    {
+        GLuint uniformIndex;
+        GLint firstLocation;
+    };
+    angle::HashMap<std::string, UniformNameIndexEntry> mUniformsByName;
+    angle::HashMap<std::string, GLuint> mUniformBlocksByName;
+
     std::vector<AtomicCounterBuffer> mAtomicCounterBuffers;
     std::vector<InterfaceBlock> mShaderStorageBlocks;
-    std::vector<BufferVariable> mBufferVariables;
+    // Only used by program interface queries.  Lazily decoded from mLazyReflection after load().
+    mutable std::vector<BufferVariable> mBufferVariables;
+
+    // Reflection that most programs never need after being loaded from a binary.  load() keeps it
+    // in its serialized form, which is decoded into the above the first time it's accessed.  If
+    // the program is saved before then, it's written back as is.
+    mutable std::vector<uint8_t> mLazyReflection;
+    // The decode happens in const accessors, which are also called without the share group lock,
+    // such as by the GL and Metal backends while a program is loaded in a worker thread.  It's
+    // therefore done under mLazyReflectionMutex and published through mLazyReflectionDecoded.
+    // Once that is set, the decoded members are not written again until the executable is reset
+    // or loaded, so readers that observe it don't need the lock.
+    mutable angle::SimpleMutex mLazyReflectionMutex;
+    mutable std::atomic<bool> mLazyReflectionDecoded{true};
 
     // An array of the samplers that are used by the program
     std::vector<SamplerBinding> mSamplerBindings;
@@ -1632,10 +1632,10 @@ void LinkingVariables::initForProgram(const ProgramState &state)
         const SharedCompiledShaderState &shader = state.getAttachedShader(shaderType);
         if (shader)
         {
-            outputVaryings[shaderType] = shader->outputVaryings;
-            inputVaryings[shaderType]  = shader->inputVaryings;
-            uniforms[shaderType]       = shader->uniforms;
-            uniformBlocks[shaderType]  = shader->uniformBlocks;
+            outputVaryings[shaderType] = &shader->outputVaryings;
+            inputVaryings[shaderType]  = &shader->inputVaryings;
+            uniforms[shaderType]       = &shader->uniforms;
+            uniformBlocks[shaderType]  = &shader->uniformBlocks;
             isShaderStageUsedBitset.set(shaderType);
         }
     }
@@ -1647,10 +1647,10 @@ void LinkingVariables::initForProgramPipeline(const ProgramPipelineState &state)
     {
         const SharedProgramExecutable &executable = state.getShaderProgramExecutable(shaderType);
         ASSERT(executable);
-        outputVaryings[shaderType] = executable->getLinkedOutputVaryings(shaderType);
-        inputVaryings[shaderType]  = executable->getLinkedInputVaryings(shaderType);
-        uniforms[shaderType]       = executable->getLinkedUniforms(shaderType);
-        uniformBlocks[shaderType]  = executable->getLinkedUniformBlocks(shaderType);
+        outputVaryings[shaderType] = &executable->getLinkedOutputVaryings(shaderType);
+        inputVaryings[shaderType]  = &executable->getLinkedInputVaryings(shaderType);
+        uniforms[shaderType]       = &executable->getLinkedUniforms(shaderType);
+        uniformBlocks[shaderType]  = &executable->getLinkedUniformBlocks(shaderType);
         isShaderStageUsedBitset.set(shaderType);
     }
 }
@@ -1783,7 +1783,7 @@ bool LinkValidateProgramGlobalNames(InfoLog &infoLog,
         }
 
         // Build a map of Uniforms
-        const std::vector<sh::ShaderVariable> &uniforms = linkingVariables.uniforms[shaderType];
+        const std::vector<sh::ShaderVariable> &uniforms = *linkingVariables.uniforms[shaderType];
         for (const auto &uniform : uniforms)
         {
             uniformMap[uniform.name] = &uniform;
@@ -1793,7 +1793,7 @@ bool LinkValidateProgramGlobalNames(InfoLog &infoLog,
         // This will also detect any field name conflicts between Uniform Blocks without instance
         // names
         const std::vector<sh::InterfaceBlock> &uniformBlocks =
-            linkingVariables.uniformBlocks[shaderType];
+            *linkingVariables.uniformBlocks[shaderType];
 
         for (const auto &uniformBlock : uniformBlocks)
         {
@@ -1860,7 +1860,7 @@ bool LinkValidateProgramGlobalNames(InfoLog &infoLog,
         // but not in another (e.g., a fragment shader), then that name is still
         // available in the other stage for a different use.
         std::unordered_set<std::string> uniforms;
-        for (const sh::ShaderVariable &uniform : linkingVariables.uniforms[ShaderType::Vertex])
+        for (const sh::ShaderVariable &uniform : *linkingVariables.uniforms[ShaderType::Vertex])
         {
             uniforms.insert(uniform.name);
         }
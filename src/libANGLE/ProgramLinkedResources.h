@@ -317,10 +317,13 @@ struct LinkingVariables final : private angle::NonCopyable
     void initForProgram(const ProgramState &state);
     void initForProgramPipeline(const ProgramPipelineState &state);
 
-    ShaderMap<std::vector<sh::ShaderVariable>> outputVaryings;
-    ShaderMap<std::vector<sh::ShaderVariable>> inputVaryings;
-    ShaderMap<std::vector<sh::ShaderVariable>> uniforms;
-    ShaderMap<std::vector<sh::InterfaceBlock>> uniformBlocks;
+    // The variables are not copied, but point to the reflection of the attached shaders (or of
+    // the program executables for program pipelines), which outlives the link.  Only valid for
+    // the stages set in isShaderStageUsedBitset.
+    ShaderMap<const std::vector<sh::ShaderVariable> *> outputVaryings = {};
+    ShaderMap<const std::vector<sh::ShaderVariable> *> inputVaryings  = {};
+    ShaderMap<const std::vector<sh::ShaderVariable> *> uniforms       = {};
+    ShaderMap<const std::vector<sh::InterfaceBlock> *> uniformBlocks  = {};
     ShaderBitSet isShaderStageUsedBitset;
 };
 
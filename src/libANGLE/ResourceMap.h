@@ -5,12 +5,16 @@
 //
 // ResourceMap:
 //   An optimized resource map which packs the first set of allocated objects into a
-//   flat array, and then falls back to an unordered map for the higher handle values.
+//   flat array, the next set into lazily allocated fixed-size pages, and then falls back to an
+//   unordered map for the higher handle values.
 //
 
 #ifndef LIBANGLE_RESOURCE_MAP_H_
 #define LIBANGLE_RESOURCE_MAP_H_
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <type_traits>
 
@@ -126,7 +130,7 @@ class ResourceMap final : angle::NonCopyable
             return (value == InvalidPointer() ? nullptr : value);
         }
 
-        return findInHashedResources(handle);
+        return findAboveFlatResources(handle);
     }
 
     // Returns true if the handle was reserved. Not necessarily if the resource is created.
@@ -155,13 +159,14 @@ class ResourceMap final : angle::NonCopyable
       private:
         friend class ResourceMap;
         Iterator(const ResourceMap &origin,
-                 GLuint flatIndex,
+                 GLuint denseIndex,
                  typename HashMap::const_iterator hashIndex,
                  bool skipNulls);
         void updateValue();
 
         const ResourceMap &mOrigin;
-        GLuint mFlatIndex;
+        // Index into the flat and paged resources, or kPagedResourcesLimit once past them.
+        GLuint mDenseIndex;
         typename HashMap::const_iterator mHashIndex;
         IndexAndResource mValue;
         bool mSkipNulls;
@@ -180,7 +185,8 @@ class ResourceMap final : angle::NonCopyable
     Iterator endWithNull() const;
 
     // Used by iterators and related functions only (due to lack of thread safety).
-    GLuint nextResource(size_t flatIndex, bool skipNulls) const;
+    GLuint nextResource(size_t denseIndex, bool skipNulls) const;
+    ResourceType *getDenseResource(GLuint denseIndex) const;
 
     // constexpr methods cannot contain reinterpret_cast, so we need a static method.
     static ResourceType *InvalidPointer();
@@ -200,6 +206,25 @@ class ResourceMap final : angle::NonCopyable
     static_assert(((kFlatResourcesLimit / kInitialFlatResourcesSize) &
                    (kFlatResourcesLimit / kInitialFlatResourcesSize - 1)) == 0);
 
+    // Handles in [kFlatResourcesLimit, kPagedResourcesLimit) are stored in pages of |kPageSize|
+    // entries.  Pages are allocated on first use and are not moved or freed until the map is
+    // cleared, so they can be read without a lock, just like the flat map.  This keeps lookups of
+    // applications with tens of thousands of live objects off the hashed path.
+    static constexpr size_t kPageSize            = 1024;
+    static constexpr size_t kPageCount           = 256;
+    static constexpr size_t kPagedResourcesLimit = kFlatResourcesLimit + kPageSize * kPageCount;
+
+    ANGLE_INLINE ResourceType **getPagedSlot(GLuint handle) const
+    {
+        ASSERT(handle >= kFlatResourcesLimit && handle < kPagedResourcesLimit);
+        const size_t pagedIndex = handle - kFlatResourcesLimit;
+        ResourceType **page     = mPages[pagedIndex / kPageSize].load(std::memory_order_acquire);
+        return page == nullptr ? nullptr : &page[pagedIndex % kPageSize];
+    }
+    ResourceType **allocatePagedSlot(GLuint handle);
+    void freePages();
+
+    ResourceType *findAboveFlatResources(GLuint handle) const;
     bool containsInHashedResources(GLuint handle) const;
     ResourceType *findInHashedResources(GLuint handle) const;
     bool eraseFromHashedResources(GLuint handle, ResourceType **resourceOut);
@@ -209,6 +234,8 @@ class ResourceMap final : angle::NonCopyable
     size_t mFlatResourcesSize;
     ResourceType **mFlatResources;
 
+    std::array<std::atomic<ResourceType **>, kPageCount> mPages;
+
     // A map of GL objects indexed by object ID.
     HashMap mHashedResources;
 
@@ -218,11 +245,11 @@ class ResourceMap final : angle::NonCopyable
     // |kFlatResourcesLimit|, but only for maps that don't need a lock (kNeedsLock == false).
     //
     // For maps that don't need a lock, this mutex is a no-op.  For those that do, the mutex is
-    // taken when allocating / deleting objects, as well as when accessing |mHashedResources|.
-    // Otherwise, access to the flat map (which never gets reallocated due to
-    // |kInitialFlatResourcesSize == kFlatResourcesLimit|) is lockless.  This latter is possible
-    // because the application is not allowed to gen/delete and bind the same ID in different
-    // threads at the same time.
+    // taken when allocating / deleting objects in |mHashedResources|, when allocating pages, as
+    // well as when accessing |mHashedResources|.  Otherwise, access to the flat map (which never
+    // gets reallocated due to |kInitialFlatResourcesSize == kFlatResourcesLimit|) and to the pages
+    // is lockless.  This latter is possible because the application is not allowed to gen/delete
+    // and bind the same ID in different threads at the same time.
     //
     // Note that because HandleAllocator is not yet thread-safe, glGen* and glDelete* functions
     // cannot be free of the share group mutex yet.  To remove the share group mutex from those
@@ -261,6 +288,10 @@ ResourceMap<ResourceType, IDType>::ResourceMap()
       mFlatResources(new ResourceType *[kInitialFlatResourcesSize])
 {
     memset(mFlatResources, kInvalidPointer, mFlatResourcesSize * sizeof(mFlatResources[0]));
+    for (std::atomic<ResourceType **> &page : mPages)
+    {
+        page.store(nullptr, std::memory_order_relaxed);
+    }
 }
 
 template <typename ResourceType, typename IDType>
@@ -268,6 +299,60 @@ ResourceMap<ResourceType, IDType>::~ResourceMap()
 {
     ASSERT(begin() == end());
     delete[] mFlatResources;
+    freePages();
+}
+
+template <typename ResourceType, typename IDType>
+ResourceType **ResourceMap<ResourceType, IDType>::allocatePagedSlot(GLuint handle)
+{
+    ResourceType **slot = getPagedSlot(handle);
+    if (ANGLE_LIKELY(slot != nullptr))
+    {
+        return slot;
+    }
+
+    std::lock_guard<Mutex> lock(mMutex);
+
+    // Check again under the lock, in case another thread allocated the page in the meantime.
+    const size_t pagedIndex            = handle - kFlatResourcesLimit;
+    std::atomic<ResourceType **> &page = mPages[pagedIndex / kPageSize];
+    ResourceType **pageResources       = page.load(std::memory_order_relaxed);
+    if (pageResources == nullptr)
+    {
+        pageResources = new ResourceType *[kPageSize];
+        memset(pageResources, kInvalidPointer, kPageSize * sizeof(pageResources[0]));
+        page.store(pageResources, std::memory_order_release);
+    }
+
+    return &pageResources[pagedIndex % kPageSize];
+}
+
+template <typename ResourceType, typename IDType>
+void ResourceMap<ResourceType, IDType>::freePages()
+{
+    for (std::atomic<ResourceType **> &page : mPages)
+    {
+        delete[] page.load(std::memory_order_relaxed);
+        page.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template <typename ResourceType, typename IDType>
+ResourceType *ResourceMap<ResourceType, IDType>::findAboveFlatResources(GLuint handle) const
+{
+    if (handle < kFlatResourcesLimit)
+    {
+        // The flat map grows to include every assigned handle below its limit.
+        return nullptr;
+    }
+
+    if (ANGLE_LIKELY(handle < kPagedResourcesLimit))
+    {
+        ResourceType **slot = getPagedSlot(handle);
+        return (slot == nullptr || *slot == InvalidPointer() ? nullptr : *slot);
+    }
+
+    return findInHashedResources(handle);
 }
 
 template <typename ResourceType, typename IDType>
@@ -313,6 +398,17 @@ ANGLE_INLINE bool ResourceMap<ResourceType, IDType>::contains(IDType id) const
         return mFlatResources[handle] != InvalidPointer();
     }
 
+    if (handle < kFlatResourcesLimit)
+    {
+        return false;
+    }
+
+    if (handle < kPagedResourcesLimit)
+    {
+        ResourceType **slot = getPagedSlot(handle);
+        return slot != nullptr && *slot != InvalidPointer();
+    }
+
     return containsInHashedResources(handle);
 }
 
@@ -332,6 +428,18 @@ bool ResourceMap<ResourceType, IDType>::erase(IDType id, ResourceType **resource
         return true;
     }
 
+    if (handle >= kFlatResourcesLimit && handle < kPagedResourcesLimit)
+    {
+        ResourceType **slot = getPagedSlot(handle);
+        if (slot == nullptr || *slot == InvalidPointer())
+        {
+            return false;
+        }
+        *resourceOut = *slot;
+        *slot        = InvalidPointer();
+        return true;
+    }
+
     return eraseFromHashedResources(handle, resourceOut);
 }
 
@@ -364,6 +472,10 @@ void ResourceMap<ResourceType, IDType>::assignAboveCurrentFlatSize(GLuint handle
         ASSERT(mFlatResourcesSize > handle);
         mFlatResources[handle] = resource;
     }
+    else if (ANGLE_LIKELY(handle < kPagedResourcesLimit))
+    {
+        *allocatePagedSlot(handle) = resource;
+    }
     else
     {
         std::lock_guard<Mutex> lock(mMutex);
@@ -395,7 +507,7 @@ typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, I
 template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, IDType>::end() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize), mHashedResources.end(), true);
+    return Iterator(*this, static_cast<GLuint>(kPagedResourcesLimit), mHashedResources.end(), true);
 }
 
 template <typename ResourceType, typename IDType>
@@ -409,7 +521,8 @@ template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator
 ResourceMap<ResourceType, IDType>::endWithNull() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize), mHashedResources.end(), false);
+    return Iterator(*this, static_cast<GLuint>(kPagedResourcesLimit), mHashedResources.end(),
+                    false);
 }
 
 template <typename ResourceType, typename IDType>
@@ -424,15 +537,16 @@ void ResourceMap<ResourceType, IDType>::clear()
     // No need for a lock as this is only called on destruction.
     memset(mFlatResources, kInvalidPointer, kInitialFlatResourcesSize * sizeof(mFlatResources[0]));
     mFlatResourcesSize = kInitialFlatResourcesSize;
+    freePages();
     mHashedResources.clear();
 }
 
 template <typename ResourceType, typename IDType>
-GLuint ResourceMap<ResourceType, IDType>::nextResource(size_t flatIndex, bool skipNulls) const
+GLuint ResourceMap<ResourceType, IDType>::nextResource(size_t denseIndex, bool skipNulls) const
 {
     // This function is only used by the iterators, access to which is marked by
     // UnsafeResourceMapIter.  Locking is the responsibility of the caller.
-    for (size_t index = flatIndex; index < mFlatResourcesSize; index++)
+    for (size_t index = denseIndex; index < mFlatResourcesSize; index++)
     {
         if ((mFlatResources[index] != nullptr || !skipNulls) &&
             mFlatResources[index] != InvalidPointer())
@@ -440,7 +554,40 @@ GLuint ResourceMap<ResourceType, IDType>::nextResource(size_t flatIndex, bool sk
             return static_cast<GLuint>(index);
         }
     }
-    return static_cast<GLuint>(mFlatResourcesSize);
+
+    size_t index = std::max(denseIndex, kFlatResourcesLimit);
+    while (index < kPagedResourcesLimit)
+    {
+        const size_t pagedIndex = index - kFlatResourcesLimit;
+        ResourceType **page     = mPages[pagedIndex / kPageSize].load(std::memory_order_relaxed);
+        if (page == nullptr)
+        {
+            // Skip to the start of the next page.
+            index += kPageSize - pagedIndex % kPageSize;
+            continue;
+        }
+
+        ResourceType *value = page[pagedIndex % kPageSize];
+        if ((value != nullptr || !skipNulls) && value != InvalidPointer())
+        {
+            return static_cast<GLuint>(index);
+        }
+        index++;
+    }
+    return static_cast<GLuint>(kPagedResourcesLimit);
+}
+
+template <typename ResourceType, typename IDType>
+ResourceType *ResourceMap<ResourceType, IDType>::getDenseResource(GLuint denseIndex) const
+{
+    if (denseIndex < mFlatResourcesSize)
+    {
+        return mFlatResources[denseIndex];
+    }
+
+    ResourceType **slot = getPagedSlot(denseIndex);
+    ASSERT(slot != nullptr);
+    return *slot;
 }
 
 template <typename ResourceType, typename IDType>
@@ -453,10 +600,10 @@ ResourceType *ResourceMap<ResourceType, IDType>::InvalidPointer()
 template <typename ResourceType, typename IDType>
 ResourceMap<ResourceType, IDType>::Iterator::Iterator(
     const ResourceMap &origin,
-    GLuint flatIndex,
+    GLuint denseIndex,
     typename ResourceMap<ResourceType, IDType>::HashMap::const_iterator hashIndex,
     bool skipNulls)
-    : mOrigin(origin), mFlatIndex(flatIndex), mHashIndex(hashIndex), mSkipNulls(skipNulls)
+    : mOrigin(origin), mDenseIndex(denseIndex), mHashIndex(hashIndex), mSkipNulls(skipNulls)
 {
     updateValue();
 }
@@ -464,7 +611,7 @@ ResourceMap<ResourceType, IDType>::Iterator::Iterator(
 template <typename ResourceType, typename IDType>
 bool ResourceMap<ResourceType, IDType>::Iterator::operator==(const Iterator &other) const
 {
-    return (mFlatIndex == other.mFlatIndex && mHashIndex == other.mHashIndex);
+    return (mDenseIndex == other.mDenseIndex && mHashIndex == other.mHashIndex);
 }
 
 template <typename ResourceType, typename IDType>
@@ -477,9 +624,9 @@ template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator &
 ResourceMap<ResourceType, IDType>::Iterator::operator++()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize))
+    if (mDenseIndex < static_cast<GLuint>(kPagedResourcesLimit))
     {
-        mFlatIndex = mOrigin.nextResource(mFlatIndex + 1, mSkipNulls);
+        mDenseIndex = mOrigin.nextResource(mDenseIndex + 1, mSkipNulls);
     }
     else
     {
@@ -506,10 +653,10 @@ ResourceMap<ResourceType, IDType>::Iterator::operator*() const
 template <typename ResourceType, typename IDType>
 void ResourceMap<ResourceType, IDType>::Iterator::updateValue()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize))
+    if (mDenseIndex < static_cast<GLuint>(kPagedResourcesLimit))
     {
-        mValue.first  = mFlatIndex;
-        mValue.second = mOrigin.mFlatResources[mFlatIndex];
+        mValue.first  = mDenseIndex;
+        mValue.second = mOrigin.getDenseResource(mDenseIndex);
     }
     else if (mHashIndex != mOrigin.mHashedResources.end())
     {
@@ -200,6 +200,69 @@ TEST(ResourceMapTest, QueryUnassignedLocked)
     QueryUnassigned<LockedType>();
 }
 
+template <typename T>
+void AssignAcrossRanges()
+{
+    // Ids in the flat map, in the paged range right above the largest flat map, spread over many
+    // pages, and far beyond the paged range.
+    std::vector<T> ids = {1, 100, 0x3000, 0x3002, 0x4000};
+    for (T id = 0x5000; id < 0x40000; id += 0x1234)
+    {
+        ids.push_back(id);
+    }
+    ids.push_back(0x1000000);
+    ids.push_back(0x7FFFFFFE);
+
+    ResourceMap<size_t, T> resourceMap;
+    std::vector<size_t> objects(ids.size());
+    for (size_t index = 0; index < ids.size(); ++index)
+    {
+        objects[index] = ids[index];
+        resourceMap.assign(ids[index], &objects[index]);
+    }
+
+    for (size_t index = 0; index < ids.size(); ++index)
+    {
+        ASSERT_TRUE(resourceMap.contains(ids[index]));
+        ASSERT_EQ(&objects[index], resourceMap.query(ids[index]));
+        ASSERT_FALSE(resourceMap.contains(ids[index] + 1));
+        ASSERT_EQ(nullptr, resourceMap.query(ids[index] + 1));
+    }
+
+    // Every id is visited exactly once.
+    std::map<GLuint, size_t *> visited;
+    for (const auto &idValue : UnsafeResourceMapIter(resourceMap))
+    {
+        ASSERT_TRUE(visited.emplace(idValue.first, idValue.second).second);
+    }
+    ASSERT_EQ(ids.size(), visited.size());
+    for (size_t index = 0; index < ids.size(); ++index)
+    {
+        ASSERT_EQ(&objects[index], visited[ids[index]]);
+    }
+
+    for (size_t index = 0; index < ids.size(); ++index)
+    {
+        size_t *found = nullptr;
+        ASSERT_TRUE(resourceMap.erase(ids[index], &found));
+        ASSERT_EQ(&objects[index], found);
+        ASSERT_FALSE(resourceMap.erase(ids[index], &found));
+    }
+
+    ASSERT_TRUE(UnsafeResourceMapIter(resourceMap).empty());
+}
+
+// Tests assigning, iterating and erasing ids in all ranges of the map.
+TEST(ResourceMapTest, AssignAcrossRangesLockless)
+{
+    AssignAcrossRanges<LocklessType>();
+}
+// Tests assigning, iterating and erasing ids in all ranges of the map.
+TEST(ResourceMapTest, AssignAcrossRangesLocked)
+{
+    AssignAcrossRanges<LockedType>();
+}
+
 void ConcurrentAccess(size_t iterations, size_t idCycleSize)
 {
     if (std::is_same_v<ResourceMapMutex, angle::NoOpMutex>)
@@ -1113,9 +1113,9 @@ ProgramMergedVaryings GetMergedVaryingsFromLinkingVariables(
             continue;
         }
         const std::vector<sh::ShaderVariable> &outputVaryings =
-            linkingVariables.outputVaryings[currentShaderType];
+            *linkingVariables.outputVaryings[currentShaderType];
         const std::vector<sh::ShaderVariable> &inputVaryings =
-            linkingVariables.inputVaryings[currentShaderType];
+            *linkingVariables.inputVaryings[currentShaderType];
 
         // Add outputs. These are always unmatched since we walk shader stages sequentially.
         for (const sh::ShaderVariable &outputVarying : outputVaryings)
@@ -31,6 +31,8 @@ struct Format final : private angle::NonCopyable
                             const rx::FastCopyFunctionMap &fastCopyFunctions,
                             rx::PixelReadFunction colorRead,
                             rx::PixelWriteFunction colorWrite,
+                            rx::PixelReadRowFunction colorReadRow,
+                            rx::PixelWriteRowFunction colorWriteRow,
                             GLenum componentType,
                             GLuint redBits,
                             GLuint greenBits,
@@ -95,6 +97,8 @@ struct Format final : private angle::NonCopyable
     rx::MipGenerationFunction mipGenerationFunction;
     rx::PixelReadFunction pixelReadFunction;
     rx::PixelWriteFunction pixelWriteFunction;
+    rx::PixelReadRowFunction pixelReadRowFunction;
+    rx::PixelWriteRowFunction pixelWriteRowFunction;
 
     // A map from a gl::FormatType to a fast pixel copy function for this format.
     const rx::FastCopyFunctionMap &fastCopyFunctions;
@@ -147,6 +151,8 @@ constexpr Format::Format(FormatID id,
                          const rx::FastCopyFunctionMap &fastCopyFunctions,
                          rx::PixelReadFunction colorRead,
                          rx::PixelWriteFunction colorWrite,
+                         rx::PixelReadRowFunction colorReadRow,
+                         rx::PixelWriteRowFunction colorWriteRow,
                          GLenum componentType,
                          GLuint redBits,
                          GLuint greenBits,
@@ -169,6 +175,8 @@ constexpr Format::Format(FormatID id,
       mipGenerationFunction(mipGen),
       pixelReadFunction(colorRead),
       pixelWriteFunction(colorWrite),
+      pixelReadRowFunction(colorReadRow),
+      pixelWriteRowFunction(colorWriteRow),
       fastCopyFunctions(fastCopyFunctions),
       componentType(componentType),
       redBits(redBits),
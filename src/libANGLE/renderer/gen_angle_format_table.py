@@ -68,11 +68,24 @@ namespace angle
 static constexpr rx::FastCopyFunctionMap::Entry BGRAEntry = {{angle::FormatID::R8G8B8A8_UNORM,
                                                              CopyBGRA8ToRGBA8}};
 static constexpr rx::FastCopyFunctionMap BGRACopyFunctions = {{&BGRAEntry, 1}};
+
+static constexpr rx::FastCopyFunctionMap::Entry RGBAEntry = {{angle::FormatID::B8G8R8A8_UNORM,
+                                                             CopyRGBA8ToBGRA8}};
+static constexpr rx::FastCopyFunctionMap RGBACopyFunctions = {{&RGBAEntry, 1}};
+
+static constexpr rx::FastCopyFunctionMap::Entry R5G6B5Entry = {{angle::FormatID::R8G8B8A8_UNORM,
+                                                               CopyR5G6B5ToRGBA8}};
+static constexpr rx::FastCopyFunctionMap R5G6B5CopyFunctions = {{&R5G6B5Entry, 1}};
+
+static constexpr rx::FastCopyFunctionMap::Entry RGBA16FEntry = {{
+    angle::FormatID::R32G32B32A32_FLOAT, CopyRGBA16FToRGBA32F}};
+static constexpr rx::FastCopyFunctionMap RGBA16FCopyFunctions = {{&RGBA16FEntry, 1}};
+
 static constexpr rx::FastCopyFunctionMap NoCopyFunctions;
 
 const Format gFormatInfoTable[] = {{
     // clang-format off
-    {{ FormatID::NONE, GL_NONE, GL_NONE, nullptr, NoCopyFunctions, nullptr, nullptr, GL_NONE, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, false, false, false, false, gl::VertexAttribType::InvalidEnum }},
+    {{ FormatID::NONE, GL_NONE, GL_NONE, nullptr, NoCopyFunctions, nullptr, nullptr, nullptr, nullptr, GL_NONE, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, false, false, false, false, gl::VertexAttribType::InvalidEnum }},
 {angle_format_info_cases}    // clang-format on
 }};
 
@@ -259,6 +272,22 @@ def get_color_read_function(angle_format):
     return 'ReadColor<' + channel_struct + ', ' + read_component_type + '>'
 
 
+def get_color_read_row_function(angle_format):
+    read_function = get_color_read_function(angle_format)
+    if read_function == 'nullptr':
+        return 'nullptr'
+
+    return read_function.replace('<', 'Row<', 1)
+
+
+def get_color_write_row_function(angle_format):
+    write_function = get_color_write_function(angle_format)
+    if write_function == 'nullptr':
+        return 'nullptr'
+
+    return write_function.replace('<', 'Row<', 1)
+
+
 def get_color_write_function(angle_format):
     channel_struct = get_channel_struct(angle_format)
     if channel_struct == None:
@@ -271,7 +300,7 @@ def get_color_write_function(angle_format):
     return 'WriteColor<' + channel_struct + ', ' + write_component_type + '>'
 
 
-format_entry_template = """    {{ FormatID::{id}, {glInternalFormat}, {fboImplementationInternalFormat}, {mipGenerationFunction}, {fastCopyFunctions}, {colorReadFunction}, {colorWriteFunction}, {namedComponentType}, {R}, {G}, {B}, {A}, {L}, {D}, {S}, {pixelBytes}, {componentAlignmentMask}, {isBlock}, {isFixed}, {isScaled}, {isSRGB}, {isYUV}, {vertexAttribType} }},
+format_entry_template = """    {{ FormatID::{id}, {glInternalFormat}, {fboImplementationInternalFormat}, {mipGenerationFunction}, {fastCopyFunctions}, {colorReadFunction}, {colorWriteFunction}, {colorReadRowFunction}, {colorWriteRowFunction}, {namedComponentType}, {R}, {G}, {B}, {A}, {L}, {D}, {S}, {pixelBytes}, {componentAlignmentMask}, {isBlock}, {isFixed}, {isScaled}, {isSRGB}, {isYUV}, {vertexAttribType} }},
 """
 
 
@@ -387,6 +416,8 @@ def json_to_table_data(format_id, json, angle_to_gl):
     parsed["mipGenerationFunction"] = get_mip_generation_function(parsed)
     parsed["colorReadFunction"] = get_color_read_function(parsed)
     parsed["colorWriteFunction"] = get_color_write_function(parsed)
+    parsed["colorReadRowFunction"] = get_color_read_row_function(parsed)
+    parsed["colorWriteRowFunction"] = get_color_write_row_function(parsed)
 
     for channel in angle_format.kChannels:
         if parsed["bits"] != None and channel in parsed["bits"]:
@@ -396,8 +427,14 @@ def json_to_table_data(format_id, json, angle_to_gl):
 
     parsed["namedComponentType"] = get_named_component_type(parsed["componentType"])
 
-    if format_id == "B8G8R8A8_UNORM":
-        parsed["fastCopyFunctions"] = "BGRACopyFunctions"
+    fast_copy_functions = {
+        "B8G8R8A8_UNORM": "BGRACopyFunctions",
+        "R8G8B8A8_UNORM": "RGBACopyFunctions",
+        "R5G6B5_UNORM": "R5G6B5CopyFunctions",
+        "R16G16B16A16_FLOAT": "RGBA16FCopyFunctions",
+    }
+    if format_id in fast_copy_functions:
+        parsed["fastCopyFunctions"] = fast_copy_functions[format_id]
 
     is_block = format_id.endswith("_BLOCK")
 
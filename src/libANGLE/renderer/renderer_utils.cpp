@@ -24,9 +24,18 @@
 #include "libANGLE/renderer/Format.h"
 #include "platform/Feature.h"
 
+#include <algorithm>
 #include <cctype>
 #include <cstring>
 
+#if defined(__SSE__)
+#    include <xmmintrin.h>
+#    define ANGLE_UNIFORM_MATRIX_USE_SSE
+#elif defined(__ARM_NEON)
+#    include <arm_neon.h>
+#    define ANGLE_UNIFORM_MATRIX_USE_NEON
+#endif
+
 namespace angle
 {
 namespace
@@ -273,24 +282,68 @@ void ExpandMatrix(T *target, const GLfloat *value)
 {
     static_assert(colsSrc <= colsDst && rowsSrc <= rowsDst, "Can only expand!");
 
-    // Clamp the staging data's size to the last written value so that data packed just after this
-    // matrix is not overwritten.
-    constexpr int kDstFlatSize =
-        GetFlattenedIndex<colsDst, rowsDst, IsDstColumnMajor>(colsSrc - 1, rowsSrc - 1) + 1;
-    T staging[kDstFlatSize]    = {0};
+    // The destination is written one column (or row, if row-major) at a time, each padded to the
+    // destination's size.  The padding of the last one is not written so that data packed just
+    // after this matrix is not overwritten.
+    constexpr int kVectorCount   = IsDstColumnMajor ? colsSrc : rowsSrc;
+    constexpr int kVectorSize    = IsDstColumnMajor ? rowsSrc : colsSrc;
+    constexpr int kVectorStride  = IsDstColumnMajor ? rowsDst : colsDst;
+    constexpr int kVectorPadding = kVectorStride - kVectorSize;
 
-    for (int r = 0; r < rowsSrc; r++)
+    for (int vector = 0; vector < kVectorCount; vector++)
     {
-        for (int c = 0; c < colsSrc; c++)
+        for (int element = 0; element < kVectorSize; element++)
         {
-            int srcIndex = GetFlattenedIndex<colsSrc, rowsSrc, IsSrcColumnMajor>(c, r);
-            int dstIndex = GetFlattenedIndex<colsDst, rowsDst, IsDstColumnMajor>(c, r);
+            const int c = IsDstColumnMajor ? vector : element;
+            const int r = IsDstColumnMajor ? element : vector;
 
-            staging[dstIndex] = static_cast<T>(value[srcIndex]);
+            target[element] =
+                static_cast<T>(value[GetFlattenedIndex<colsSrc, rowsSrc, IsSrcColumnMajor>(c, r)]);
         }
+
+        if (vector + 1 < kVectorCount)
+        {
+            for (int element = 0; element < kVectorPadding; element++)
+            {
+                target[kVectorSize + element] = 0;
+            }
+        }
+
+        target += kVectorStride;
     }
+}
 
-    memcpy(target, staging, kDstFlatSize * sizeof(T));
+// Transposes tightly packed 4x4 matrices.  This is the most common case of a transposed upload
+// (row-major matrices uploaded to GLSL, or column-major matrices uploaded to HLSL), used for
+// example by skinning shaders that upload hundreds of matrices per draw.
+void TransposeMatrix4x4(unsigned int count, const GLfloat *value, GLfloat *target)
+{
+    for (unsigned int i = 0; i < count; i++)
+    {
+#if defined(ANGLE_UNIFORM_MATRIX_USE_SSE)
+        __m128 row0 = _mm_loadu_ps(value);
+        __m128 row1 = _mm_loadu_ps(value + 4);
+        __m128 row2 = _mm_loadu_ps(value + 8);
+        __m128 row3 = _mm_loadu_ps(value + 12);
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+        _mm_storeu_ps(target, row0);
+        _mm_storeu_ps(target + 4, row1);
+        _mm_storeu_ps(target + 8, row2);
+        _mm_storeu_ps(target + 12, row3);
+#elif defined(ANGLE_UNIFORM_MATRIX_USE_NEON)
+        // De-interleaving every fourth element yields the columns of the row-major matrix.
+        const float32x4x4_t transposed = vld4q_f32(value);
+        vst1q_f32(target, transposed.val[0]);
+        vst1q_f32(target + 4, transposed.val[1]);
+        vst1q_f32(target + 8, transposed.val[2]);
+        vst1q_f32(target + 12, transposed.val[3]);
+#else
+        ExpandMatrix<GLfloat, false, 4, 4, true, 4, 4>(target, value);
+#endif
+
+        target += 16;
+        value += 16;
+    }
 }
 
 template <bool IsSrcColumMajor,
@@ -337,6 +390,19 @@ void SetFloatUniformMatrixFast(unsigned int arrayElementOffset,
 
     memcpy(targetData, valueData, matrixSize * count);
 }
+
+void SetFloatUniformMatrix4x4Transposed(unsigned int arrayElementOffset,
+                                        unsigned int elementCount,
+                                        GLsizei countIn,
+                                        const GLfloat *value,
+                                        uint8_t *targetData)
+{
+    const unsigned int count =
+        std::min(elementCount - arrayElementOffset, static_cast<unsigned int>(countIn));
+
+    GLfloat *target = reinterpret_cast<GLfloat *>(targetData) + arrayElementOffset * 16;
+    TransposeMatrix4x4(count, value, target);
+}
 }  // anonymous namespace
 
 bool IsRotatedAspectRatio(SurfaceRotation rotation)
@@ -518,31 +584,38 @@ void PackPixels(const PackPixelsParams &params,
         return;
     }
 
-    PixelWriteFunction pixelWriteFunction = params.destFormat->pixelWriteFunction;
-    ASSERT(pixelWriteFunction != nullptr);
+    PixelWriteRowFunction pixelWriteRowFunction = params.destFormat->pixelWriteRowFunction;
+    ASSERT(pixelWriteRowFunction != nullptr);
 
-    // Maximum size of any Color<T> type used.
-    uint8_t temp[16];
-    static_assert(sizeof(temp) >= sizeof(gl::ColorF) && sizeof(temp) >= sizeof(gl::ColorUI) &&
-                      sizeof(temp) >= sizeof(gl::ColorI) &&
-                      sizeof(temp) >= sizeof(angle::DepthStencil),
+    PixelReadRowFunction pixelReadRowFunction = sourceFormat.pixelReadRowFunction;
+    ASSERT(pixelReadRowFunction != nullptr);
+
+    // Rows are converted in chunks through an intermediate array of Color<T>, so that the format
+    // dispatch happens once per chunk instead of twice per pixel.  16 bytes is the maximum size
+    // of any Color<T> type used.
+    constexpr int kChunkPixelCount = 64;
+    alignas(16) uint8_t temp[kChunkPixelCount * 16];
+    static_assert(sizeof(temp) >= kChunkPixelCount * sizeof(gl::ColorF) &&
+                      sizeof(temp) >= kChunkPixelCount * sizeof(gl::ColorUI) &&
+                      sizeof(temp) >= kChunkPixelCount * sizeof(gl::ColorI) &&
+                      sizeof(temp) >= kChunkPixelCount * sizeof(angle::DepthStencil),
                   "Unexpected size of pixel struct.");
 
-    PixelReadFunction pixelReadFunction = sourceFormat.pixelReadFunction;
-    ASSERT(pixelReadFunction != nullptr);
+    const int destPixelBytes = static_cast<int>(params.destFormat->pixelBytes);
 
     for (int y = 0; y < destHeight; ++y)
     {
-        for (int x = 0; x < destWidth; ++x)
+        uint8_t *destRow      = destWithOffset + y * params.outputPitch;
+        const uint8_t *srcRow = source + y * yAxisPitch;
+
+        for (int x = 0; x < destWidth; x += kChunkPixelCount)
         {
-            uint8_t *dest =
-                destWithOffset + y * params.outputPitch + x * params.destFormat->pixelBytes;
-            const uint8_t *src = source + y * yAxisPitch + x * xAxisPitch;
+            const int pixelCount = std::min(kChunkPixelCount, destWidth - x);
 
             // readFunc and writeFunc will be using the same type of color, CopyTexImage
             // will not allow the copy otherwise.
-            pixelReadFunction(src, temp);
-            pixelWriteFunction(temp, dest);
+            pixelReadRowFunction(srcRow + x * xAxisPitch, xAxisPitch, temp, pixelCount);
+            pixelWriteRowFunction(temp, destRow + x * destPixelBytes, destPixelBytes, pixelCount);
         }
     }
 }
@@ -933,6 +1006,11 @@ void SetFloatUniformMatrixGLSL<cols, 4>::Run(unsigned int arrayElementOffset,
         SetFloatUniformMatrixFast(arrayElementOffset, elementCount, countIn, srcMatrixSize, value,
                                   targetData);
     }
+    else if (cols == 4)
+    {
+        SetFloatUniformMatrix4x4Transposed(arrayElementOffset, elementCount, countIn, value,
+                                           targetData);
+    }
     else
     {
         // fallback to general cases
@@ -980,6 +1058,11 @@ void SetFloatUniformMatrixHLSL<4, rows>::Run(unsigned int arrayElementOffset,
         SetFloatUniformMatrixFast(arrayElementOffset, elementCount, countIn, srcMatrixSize, value,
                                   targetData);
     }
+    else if (rows == 4)
+    {
+        SetFloatUniformMatrix4x4Transposed(arrayElementOffset, elementCount, countIn, value,
+                                           targetData);
+    }
     else
     {
         // fallback to general cases
@@ -1229,9 +1312,17 @@ void SetUniformMatrixfv(const gl::ProgramExecutable *executable,
                         DefaultUniformBlockMap *defaultUniformBlocks,
                         gl::ShaderBitSet *defaultUniformBlocksDirty)
 {
+    constexpr size_t kMatrixStride = cols * 4 * sizeof(GLfloat);
+
     const gl::VariableLocation &locationInfo = executable->getUniformLocations()[location];
     const gl::LinkedUniform &linkedUniform   = executable->getUniforms()[locationInfo.index];
 
+    // The matrices are laid out the same way in every shader stage, with each column padded to 4
+    // rows.  They are converted for the first stage that uses the uniform, and the result is
+    // copied to the other stages.
+    const uint8_t *convertedData = nullptr;
+    size_t convertedSize         = 0;
+
     for (const gl::ShaderType shaderType : executable->getLinkedShaderStages())
     {
         BufferAndLayout &uniformBlock         = *(*defaultUniformBlocks)[shaderType];
@@ -1243,9 +1334,25 @@ void SetUniformMatrixfv(const gl::ProgramExecutable *executable,
             continue;
         }
 
-        SetFloatUniformMatrixGLSL<cols, rows>::Run(
-            locationInfo.arrayIndex, linkedUniform.getBasicTypeElementCount(), count, transpose,
-            value, uniformBlock.uniformData.data() + layoutInfo.offset);
+        uint8_t *targetData = uniformBlock.uniformData.data() + layoutInfo.offset;
+
+        if (convertedData != nullptr)
+        {
+            memcpy(targetData + locationInfo.arrayIndex * kMatrixStride, convertedData,
+                   convertedSize);
+        }
+        else
+        {
+            const unsigned int elementCount = linkedUniform.getBasicTypeElementCount();
+            SetFloatUniformMatrixGLSL<cols, rows>::Run(locationInfo.arrayIndex, elementCount,
+                                                       count, transpose, value, targetData);
+
+            // The padding after the last column of the last matrix is not written.
+            const unsigned int matrixCount = std::min(elementCount - locationInfo.arrayIndex,
+                                                      static_cast<unsigned int>(count));
+            convertedData = targetData + locationInfo.arrayIndex * kMatrixStride;
+            convertedSize = matrixCount * kMatrixStride - (4 - rows) * sizeof(GLfloat);
+        }
 
         defaultUniformBlocksDirty->set(shaderType);
     }
@@ -92,6 +92,14 @@ using MipGenerationFunction = void (*)(size_t sourceWidth,
 
 typedef void (*PixelReadFunction)(const uint8_t *source, uint8_t *dest);
 typedef void (*PixelWriteFunction)(const uint8_t *source, uint8_t *dest);
+typedef void (*PixelReadRowFunction)(const uint8_t *source,
+                                     int sourcePixelPitch,
+                                     uint8_t *dest,
+                                     int pixelCount);
+typedef void (*PixelWriteRowFunction)(const uint8_t *source,
+                                      uint8_t *dest,
+                                      int destPixelPitch,
+                                      int pixelCount);
 typedef void (*FastCopyFunction)(const uint8_t *source,
                                  int srcXAxisPitch,
                                  int srcYAxisPitch,
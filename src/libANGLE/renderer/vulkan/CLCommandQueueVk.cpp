@@ -449,15 +449,9 @@ angle::Result CLCommandQueueVk::enqueueCopyBuffer(const cl::Buffer &srcBuffer,
     ANGLE_TRY(getCommandBuffer(access, &commandBuffer));
 
     VkBufferCopy copyRegion = {srcOffset, dstOffset, size};
-    // update the offset in the case of sub-buffers
-    if (srcBufferVk->getOffset())
-    {
-        copyRegion.srcOffset += srcBufferVk->getOffset();
-    }
-    if (dstBufferVk->getOffset())
-    {
-        copyRegion.dstOffset += dstBufferVk->getOffset();
-    }
+    // update the offset in the case of sub-buffers and pool suballocations
+    copyRegion.srcOffset += srcBufferVk->getDeviceOffset();
+    copyRegion.dstOffset += dstBufferVk->getDeviceOffset();
     commandBuffer->copyBuffer(srcBufferVk->getBuffer().getBuffer(),
                               dstBufferVk->getBuffer().getBuffer(), 1, &copyRegion);
 
@@ -686,8 +680,8 @@ angle::Result CLCommandQueueVk::addToHostTransferList(CLBufferVk *srcBuffer,
                                        transferConfig.size};
             ANGLE_TRY(transferBufferHandleVk.copyFrom(transferConfig.srcHostPtr,
                                                       transferConfig.offset, transferConfig.size));
-            copyRegion.srcOffset += transferBufferHandleVk.getOffset();
-            copyRegion.dstOffset += srcBuffer->getOffset();
+            copyRegion.srcOffset += transferBufferHandleVk.getDeviceOffset();
+            copyRegion.dstOffset += srcBuffer->getDeviceOffset();
             mComputePassCommands->getCommandBuffer().copyBuffer(
                 transferBufferHandleVk.getBuffer().getBuffer(), srcBuffer->getBuffer().getBuffer(),
                 1, &copyRegion);
@@ -705,8 +699,8 @@ angle::Result CLCommandQueueVk::addToHostTransferList(CLBufferVk *srcBuffer,
             for (VkBufferCopy &copyRegion :
                  transferBufferHandleVk.rectCopyRegions(transferConfig.dstRect))
             {
-                copyRegion.srcOffset += transferBufferHandleVk.getOffset();
-                copyRegion.dstOffset += srcBuffer->getOffset();
+                copyRegion.srcOffset += transferBufferHandleVk.getDeviceOffset();
+                copyRegion.dstOffset += srcBuffer->getDeviceOffset();
                 mComputePassCommands->getCommandBuffer().copyBuffer(
                     transferBufferHandleVk.getBuffer().getBuffer(),
                     srcBuffer->getBuffer().getBuffer(), 1, &copyRegion);
@@ -723,8 +717,8 @@ angle::Result CLCommandQueueVk::addToHostTransferList(CLBufferVk *srcBuffer,
         {
             VkBufferCopy copyRegion = {transferConfig.offset, transferConfig.offset,
                                        transferConfig.size};
-            copyRegion.srcOffset += srcBuffer->getOffset();
-            copyRegion.dstOffset += transferBufferHandleVk.getOffset();
+            copyRegion.srcOffset += srcBuffer->getDeviceOffset();
+            copyRegion.dstOffset += transferBufferHandleVk.getDeviceOffset();
             mComputePassCommands->getCommandBuffer().copyBuffer(
                 srcBuffer->getBuffer().getBuffer(), transferBufferHandleVk.getBuffer().getBuffer(),
                 1, &copyRegion);
@@ -740,8 +734,8 @@ angle::Result CLCommandQueueVk::addToHostTransferList(CLBufferVk *srcBuffer,
             for (VkBufferCopy &copyRegion :
                  transferBufferHandleVk.rectCopyRegions(transferConfig.srcRect))
             {
-                copyRegion.srcOffset += srcBuffer->getOffset();
-                copyRegion.dstOffset += transferBufferHandleVk.getOffset();
+                copyRegion.srcOffset += srcBuffer->getDeviceOffset();
+                copyRegion.dstOffset += transferBufferHandleVk.getDeviceOffset();
                 mComputePassCommands->getCommandBuffer().copyBuffer(
                     srcBuffer->getBuffer().getBuffer(),
                     transferBufferHandleVk.getBuffer().getBuffer(), 1, &copyRegion);
@@ -761,8 +755,8 @@ angle::Result CLCommandQueueVk::addToHostTransferList(CLBufferVk *srcBuffer,
             ANGLE_TRY(transferBufferHandleVk.fillWithPattern(
                 transferConfig.srcHostPtr, transferConfig.patternSize, transferConfig.offset,
                 transferConfig.size));
-            copyRegion.srcOffset += transferBufferHandleVk.getOffset();
-            copyRegion.dstOffset += srcBuffer->getOffset();
+            copyRegion.srcOffset += transferBufferHandleVk.getDeviceOffset();
+            copyRegion.dstOffset += srcBuffer->getDeviceOffset();
             mComputePassCommands->getCommandBuffer().copyBuffer(
                 transferBufferHandleVk.getBuffer().getBuffer(), srcBuffer->getBuffer().getBuffer(),
                 1, &copyRegion);
@@ -811,7 +805,8 @@ angle::Result CLCommandQueueVk::addToHostTransferList(CLImageVk *srcImage,
     // Enqueue blit
     CLBufferVk &transferBufferHandleVk = transferBufferHandle->getImpl<CLBufferVk>();
     ANGLE_TRY(copyImageToFromBuffer(*srcImage, transferBufferHandleVk.getBuffer(),
-                                    transferConfig.origin, transferConfig.region, 0,
+                                    transferConfig.origin, transferConfig.region,
+                                    transferBufferHandleVk.getDeviceOffset(),
                                     ImageBufferCopyDirection::ToBuffer));
 
     return angle::Result::Continue;
@@ -1022,7 +1017,8 @@ angle::Result CLCommandQueueVk::enqueueCopyImageToBuffer(const cl::Image &srcIma
     ANGLE_TRY(processWaitlist(waitEvents));
 
     ANGLE_TRY(copyImageToFromBuffer(srcImageVk, dstBufferVk.getBuffer(), srcOrigin, region,
-                                    dstOffset, ImageBufferCopyDirection::ToBuffer));
+                                    dstBufferVk.getDeviceOffset() + dstOffset,
+                                    ImageBufferCopyDirection::ToBuffer));
 
     ANGLE_TRY(createEvent(eventCreateFunc, cl::ExecutionStatus::Queued));
 
@@ -1044,7 +1040,8 @@ angle::Result CLCommandQueueVk::enqueueCopyBufferToImage(const cl::Buffer &srcBu
     ANGLE_TRY(processWaitlist(waitEvents));
 
     ANGLE_TRY(copyImageToFromBuffer(dstImageVk, srcBufferVk.getBuffer(), dstOrigin, region,
-                                    srcOffset, ImageBufferCopyDirection::ToImage));
+                                    srcBufferVk.getDeviceOffset() + srcOffset,
+                                    ImageBufferCopyDirection::ToImage));
 
     ANGLE_TRY(createEvent(eventCreateFunc, cl::ExecutionStatus::Queued));
 
@@ -1632,7 +1629,7 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk)
                 VkDescriptorBufferInfo &bufferInfo =
                     kernelArgDescSetBuilder.allocDescriptorBufferInfo();
                 bufferInfo.range  = clMem->getSize();
-                bufferInfo.offset = clMem->getOffset();
+                bufferInfo.offset = vkMem.getDeviceOffset();
                 bufferInfo.buffer = vkMem.getBuffer().getBuffer().getHandle();
                 VkWriteDescriptorSet &writeDescriptorSet =
                     kernelArgDescSetBuilder.allocWriteDescriptorSet();
@@ -1813,7 +1810,7 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk)
 
         VkDescriptorBufferInfo &bufferInfo = kernelArgDescSetBuilder.allocDescriptorBufferInfo();
         bufferInfo.range                   = clMem->getSize();
-        bufferInfo.offset                  = clMem->getOffset();
+        bufferInfo.offset                  = vkMem.getDeviceOffset();
         bufferInfo.buffer                  = vkMem.getBuffer().getBuffer().getHandle();
 
         ANGLE_TRY(addMemoryDependencies(clMem.get()));
@@ -1846,7 +1843,7 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk)
 
         auto &bufferInfo  = printfDescSetBuilder.allocDescriptorBufferInfo();
         bufferInfo.range  = clMem->getSize();
-        bufferInfo.offset = clMem->getOffset();
+        bufferInfo.offset = vkMem.getDeviceOffset();
         bufferInfo.buffer = vkMem.getBuffer().getBuffer().getHandle();
 
         auto &writeDescriptorSet           = printfDescSetBuilder.allocWriteDescriptorSet();
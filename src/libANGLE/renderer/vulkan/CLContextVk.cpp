@@ -14,9 +14,12 @@
 #include "libANGLE/renderer/vulkan/CLSamplerVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
+#include "libANGLE/renderer/vulkan/vk_cl_utils.h"
 #include "libANGLE/renderer/vulkan/vk_renderer.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
+#include "common/system_utils.h"
+
 #include "libANGLE/CLBuffer.h"
 #include "libANGLE/CLContext.h"
 #include "libANGLE/CLEvent.h"
@@ -27,16 +30,54 @@
 namespace rx
 {
 
+namespace
+{
+// Time interval in seconds that we should try to prune the CL buffer pools.
+constexpr double kTimeElapsedForPruneBufferPool = 0.25;
+
+// Base address alignment in bytes that CLDeviceVk reports through CL_DEVICE_MEM_BASE_ADDR_ALIGN.
+constexpr VkDeviceSize kMemBaseAddrAlignBytes = 1024 / 8;
+}  // namespace
+
+#define ANGLE_ENABLE_CL_BUFFER_POOL_STATS_LOGGING false
+
 CLContextVk::CLContextVk(const cl::Context &context, const cl::DevicePtrs devicePtrs)
     : CLContextImpl(context),
       vk::Context(getPlatform()->getRenderer()),
+      mBufferPoolAlignment(0),
+      mLastBufferPoolPruneTime(angle::GetCurrentSystemTime()),
       mAssociatedDevices(devicePtrs)
 {
     mDeviceQueueIndex = mRenderer->getDefaultDeviceQueueIndex();
+
+    // Every CL buffer may be bound as a uniform, storage or texel buffer, and sub-buffers must
+    // honor the reported base address alignment relative to their parent.
+    const VkPhysicalDeviceLimits &limits = mRenderer->getPhysicalDeviceProperties().limits;
+
+    mBufferPoolAlignment =
+        std::max({kMemBaseAddrAlignBytes, limits.minUniformBufferOffsetAlignment,
+                  limits.minStorageBufferOffsetAlignment, limits.minTexelBufferOffsetAlignment});
 }
 
 CLContextVk::~CLContextVk()
 {
+#if ANGLE_ENABLE_CL_BUFFER_POOL_STATS_LOGGING
+    logBufferPools();
+#endif
+
+    for (vk::BufferPoolPointerArray &pools : mBufferPools)
+    {
+        for (std::unique_ptr<vk::BufferPool> &pool : pools)
+        {
+            if (pool)
+            {
+                // Buffers released right before the context may still be waiting for their queue
+                // serial; their blocks are handed over to the renderer's orphan list.
+                pool->destroy(getRenderer(), true);
+            }
+        }
+    }
+
     mMetaDescriptorPool.destroy(getRenderer());
     mDescriptorSetLayoutCache.destroy(getRenderer());
     mPipelineLayoutCache.destroy(getRenderer());
@@ -374,4 +415,131 @@ angle::Result CLContextVk::allocateDescriptorSet(
     return kernelVk->allocateDescriptorSet(index, layoutIndex, computePassCommands);
 }
 
+angle::Result CLContextVk::initBufferAllocation(vk::BufferHelper *bufferHelper,
+                                                VkDeviceSize size,
+                                                VkMemoryPropertyFlags memoryPropertyFlags)
+{
+    const vk::Allocator &allocator = mRenderer->getAllocator();
+
+    VkBufferCreateInfo createInfo    = {};
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.flags                 = 0;
+    createInfo.size                  = size;
+    createInfo.usage                 = cl_vk::GetBufferUsageFlags(cl::MemFlags{});
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    uint32_t memoryTypeIndex = 0;
+    ANGLE_VK_TRY(this, allocator.findMemoryTypeIndexForBufferInfo(
+                           createInfo, memoryPropertyFlags, 0,
+                           mRenderer->getFeatures().persistentlyMappedBuffers.enabled,
+                           &memoryTypeIndex));
+
+    VkDeviceSize allocationSize = size;
+    if (allocationSize <= kMaxPow2RoundedBufferSize)
+    {
+        allocationSize = gl::ceilPow2(static_cast<unsigned int>(allocationSize));
+    }
+
+    std::lock_guard<angle::SimpleMutex> lock(mBufferPoolMutex);
+
+    if (angle::GetCurrentSystemTime() - mLastBufferPoolPruneTime > kTimeElapsedForPruneBufferPool)
+    {
+        pruneBufferPools();
+    }
+
+    vk::BufferPool *pool               = getBufferPool(allocationSize, memoryTypeIndex);
+    const uint64_t newBlockCallsBefore = getPerfCounters().allocateNewBufferBlockCalls;
+
+    VkResult result =
+        bufferHelper->initSuballocation(this, memoryTypeIndex, static_cast<size_t>(allocationSize),
+                                        static_cast<size_t>(mBufferPoolAlignment),
+                                        BufferUsageType::Dynamic, pool);
+    if (result == VK_ERROR_OUT_OF_DEVICE_MEMORY)
+    {
+        // Released buffers may still be pending garbage cleanup; reclaim their ranges and retry.
+        bool anyGarbageCleaned = false;
+        do
+        {
+            ANGLE_TRY(mRenderer->cleanupSomeGarbage(this, &anyGarbageCleaned));
+            if (anyGarbageCleaned)
+            {
+                result = bufferHelper->initSuballocation(
+                    this, memoryTypeIndex, static_cast<size_t>(allocationSize),
+                    static_cast<size_t>(mBufferPoolAlignment), BufferUsageType::Dynamic, pool);
+            }
+        } while (result != VK_SUCCESS && anyGarbageCleaned);
+    }
+    ANGLE_VK_TRY(this, result);
+
+    mPerfCounters.clBufferPoolAllocations++;
+    if (allocationSize < vk::BufferPool::kMaxBufferSizeForSuballocation &&
+        getPerfCounters().allocateNewBufferBlockCalls == newBlockCallsBefore)
+    {
+        mPerfCounters.clBufferPoolHits++;
+    }
+
+    return angle::Result::Continue;
+}
+
+vk::BufferPool *CLContextVk::getBufferPool(VkDeviceSize size, uint32_t memoryTypeIndex)
+{
+    size_t sizeClass = 0;
+    while (sizeClass < ArraySize(kBufferPoolSizeClassLimits) &&
+           size > kBufferPoolSizeClassLimits[sizeClass])
+    {
+        ++sizeClass;
+    }
+
+    std::unique_ptr<vk::BufferPool> &pool = mBufferPools[sizeClass][memoryTypeIndex];
+    if (!pool)
+    {
+        VkMemoryPropertyFlags memoryPropertyFlags;
+        mRenderer->getAllocator().getMemoryTypeProperties(memoryTypeIndex, &memoryPropertyFlags);
+
+        pool                                  = std::make_unique<vk::BufferPool>();
+        vma::VirtualBlockCreateFlags vmaFlags = vma::VirtualBlockCreateFlagBits::GENERAL;
+        pool->initWithFlags(mRenderer, vmaFlags, cl_vk::GetBufferUsageFlags(cl::MemFlags{}), 0,
+                            memoryTypeIndex, memoryPropertyFlags);
+    }
+
+    return pool.get();
+}
+
+void CLContextVk::pruneBufferPools()
+{
+    mLastBufferPoolPruneTime = angle::GetCurrentSystemTime();
+
+    for (vk::BufferPoolPointerArray &pools : mBufferPools)
+    {
+        for (std::unique_ptr<vk::BufferPool> &pool : pools)
+        {
+            if (pool)
+            {
+                pool->pruneEmptyBuffers(mRenderer);
+            }
+        }
+    }
+}
+
+void CLContextVk::logBufferPools() const
+{
+    for (size_t sizeClass = 0; sizeClass < mBufferPools.size(); ++sizeClass)
+    {
+        for (size_t i = 0; i < mBufferPools[sizeClass].size(); ++i)
+        {
+            const std::unique_ptr<vk::BufferPool> &pool = mBufferPools[sizeClass][i];
+            if (pool && pool->getBufferCount() > 0)
+            {
+                std::ostringstream log;
+                pool->addStats(&log);
+                INFO() << "CL Pool[" << sizeClass << "][" << i << "]:" << log.str();
+            }
+        }
+    }
+    INFO() << "CL buffer allocations: " << getPerfCounters().clBufferPoolAllocations
+           << " pool hits: " << getPerfCounters().clBufferPoolHits;
+}
+
 }  // namespace rx
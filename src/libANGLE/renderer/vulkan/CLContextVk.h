@@ -107,13 +107,39 @@ class CLContextVk : public CLContextImpl, public vk::Context
         angle::EnumIterator<DescriptorSetIndex> layoutIndex,
         vk::OutsideRenderPassCommandBufferHelper *computePassCommands);
 
+    // Suballocates the storage of a CL buffer from the context's size-classed buffer pools.  When
+    // the buffer is released, its range is returned to the pool once the queue serials using it
+    // have completed, so short-lived buffers recycle existing memory blocks.
+    angle::Result initBufferAllocation(vk::BufferHelper *bufferHelper,
+                                       VkDeviceSize size,
+                                       VkMemoryPropertyFlags memoryPropertyFlags);
+
   private:
     void handleDeviceLost() const;
     VkFormat getVkFormatFromCL(cl_image_format format);
 
+    vk::BufferPool *getBufferPool(VkDeviceSize size, uint32_t memoryTypeIndex);
+    void pruneBufferPools();
+    void logBufferPools() const;
+
     // mutex to synchronize the descriptor set allocations
     angle::SimpleMutex mDescriptorSetMutex;
 
+    // CL buffers are bucketed into pools by size, so that temporary buffers of similar size
+    // recycle each other's ranges and small allocations don't fragment the blocks that hold large
+    // ones.  Sizes below kMaxPow2RoundedBufferSize are rounded up to a power of two for the same
+    // reason.
+    static constexpr size_t kBufferPoolSizeClassCount          = 4;
+    static constexpr VkDeviceSize kMaxPow2RoundedBufferSize    = 64 * 1024;
+    static constexpr VkDeviceSize kBufferPoolSizeClassLimits[] = {4 * 1024, 64 * 1024,
+                                                                  1024 * 1024};
+
+    // mutex to synchronize the buffer pool allocations
+    angle::SimpleMutex mBufferPoolMutex;
+    std::array<vk::BufferPoolPointerArray, kBufferPoolSizeClassCount> mBufferPools;
+    VkDeviceSize mBufferPoolAlignment;
+    double mLastBufferPoolPruneTime;
+
     // Caches for DescriptorSetLayout and PipelineLayout
     DescriptorSetLayoutCache mDescriptorSetLayoutCache;
     PipelineLayoutCache mPipelineLayoutCache;
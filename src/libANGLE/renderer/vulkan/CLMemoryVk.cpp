@@ -167,11 +167,6 @@ CLBufferVk::CLBufferVk(const cl::Buffer &buffer) : CLMemoryVk(buffer)
     {
         mParent = &buffer.getParent()->getImpl<CLBufferVk>();
     }
-    mDefaultBufferCreateInfo             = {};
-    mDefaultBufferCreateInfo.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    mDefaultBufferCreateInfo.size        = buffer.getSize();
-    mDefaultBufferCreateInfo.usage       = getVkUsageFlags();
-    mDefaultBufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 }
 
 CLBufferVk::~CLBufferVk()
@@ -180,7 +175,8 @@ CLBufferVk::~CLBufferVk()
     {
         unmap();
     }
-    mBuffer.destroy(mRenderer);
+    // Return the suballocation to the context's buffer pool once the GPU is done with it.
+    mBuffer.release(mRenderer);
 }
 
 vk::BufferHelper &CLBufferVk::getBuffer()
@@ -196,10 +192,8 @@ angle::Result CLBufferVk::create(void *hostPtr)
 {
     if (!isSubBuffer())
     {
-        VkBufferCreateInfo createInfo  = mDefaultBufferCreateInfo;
-        createInfo.size                = getSize();
         VkMemoryPropertyFlags memFlags = getVkMemPropertyFlags();
-        if (IsError(mBuffer.init(mContext, createInfo, memFlags)))
+        if (IsError(mContext->initBufferAllocation(&mBuffer, getSize(), memFlags)))
         {
             ANGLE_CL_RETURN_ERROR(CL_OUT_OF_RESOURCES);
         }
@@ -922,7 +916,7 @@ angle::Result CLImageVk::getBufferView(const vk::BufferView **viewOut)
     CLBufferVk *parent = getParent<CLBufferVk>();
 
     return mBufferViews.getView(
-        mContext, parent->getBuffer(), parent->getOffset(),
+        mContext, parent->getBuffer(), parent->getDeviceOffset(),
         mContext->getRenderer()->getFormat(CLImageFormatToAngleFormat(getFormat())), viewOut);
 }
 
@@ -119,6 +119,11 @@ class CLBufferVk : public CLMemoryVk
 
     bool isSubBuffer() const { return mParent != nullptr; }
 
+    // Offset of this buffer's data in the underlying VkBuffer.  This includes both the sub-buffer
+    // offset and the offset of the pool suballocation, and is what Vulkan commands and descriptors
+    // must use.  Mapped pointers already account for the suballocation offset.
+    VkDeviceSize getDeviceOffset() { return getBuffer().getOffset() + getOffset(); }
+
     angle::Result setRect(const void *data,
                           const cl::BufferRect &srcRect,
                           const cl::BufferRect &bufferRect);
@@ -137,7 +142,6 @@ class CLBufferVk : public CLMemoryVk
     angle::Result setDataImpl(const uint8_t *data, size_t size, size_t offset);
 
     vk::BufferHelper mBuffer;
-    VkBufferCreateInfo mDefaultBufferCreateInfo;
 };
 
 class CLImageVk : public CLMemoryVk
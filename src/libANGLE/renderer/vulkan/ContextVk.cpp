@@ -179,6 +179,7 @@ constexpr gl::ShaderMap<vk::ImageLayout> kShaderWriteImageLayouts = {
 
 constexpr VkBufferUsageFlags kVertexBufferUsage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
 constexpr size_t kDynamicVertexDataSize         = 16 * 1024;
+constexpr size_t kDynamicIndirectDataSize       = 16 * 1024;
 
 bool CanMultiDrawIndirectUseCmd(ContextVk *contextVk,
                                 VertexArrayVk *vertexArray,
@@ -204,6 +205,28 @@ bool CanMultiDrawIndirectUseCmd(ContextVk *contextVk,
     return canMultiDrawIndirectUseCmd;
 }
 
+// Whether the draws of a client-side multi-draw call can be issued with a single indirect draw
+// command.  Besides the requirements of multi-draw indirect, every draw must see the same state, so
+// uniforms emulating gl_DrawID or the base vertex/instance, and transform feedback emulation (which
+// needs per-draw offsets) prevent batching.
+bool CanBatchClientMultiDraw(ContextVk *contextVk,
+                             VertexArrayVk *vertexArray,
+                             gl::PrimitiveMode mode,
+                             GLsizei drawcount)
+{
+    if (drawcount <= 1 || !CanMultiDrawIndirectUseCmd(contextVk, vertexArray, mode, drawcount, 0))
+    {
+        return false;
+    }
+
+    const gl::State &glState                = contextVk->getState();
+    const gl::ProgramExecutable *executable = glState.getProgramExecutable();
+    ASSERT(executable);
+
+    return !executable->hasDrawIDUniform() && !executable->hasBaseVertexUniform() &&
+           !executable->hasBaseInstanceUniform() && !glState.isTransformFeedbackActiveUnpaused();
+}
+
 uint32_t GetCoverageSampleCount(const gl::State &glState, GLint samples)
 {
     ASSERT(glState.isSampleCoverageEnabled());
@@ -844,6 +867,7 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
       mFlipViewportForDrawFramebuffer(false),
       mFlipViewportForReadFramebuffer(false),
       mIsAnyHostVisibleBufferWritten(false),
+      mHasInFlightStreamedIndirectBuffers(false),
       mCurrentQueueSerialIndex(kInvalidQueueSerialIndex),
       mOutsideRenderPassCommands(nullptr),
       mRenderPassCommands(nullptr),
@@ -1244,6 +1268,7 @@ void ContextVk::onDestroy(const gl::Context *context)
     {
         defaultBuffer.destroy(mRenderer);
     }
+    mStreamedIndirectBuffer.destroy(mRenderer);
 
     for (vk::DynamicQueryPool &queryPool : mQueryPools)
     {
@@ -1320,6 +1345,8 @@ angle::Result ContextVk::initialize(const angle::ImageLoadContext &imageLoadCont
 
     ANGLE_TRY(mShareGroupVk->unifyContextsPriority(this));
 
+    mRenderer->warmUpInternalPipelines();
+
     ANGLE_TRY(mQueryPools[gl::QueryType::AnySamples].init(this, VK_QUERY_TYPE_OCCLUSION,
                                                           vk::kDefaultOcclusionQueryPoolSize));
     ANGLE_TRY(mQueryPools[gl::QueryType::AnySamplesConservative].init(
@@ -1369,6 +1396,8 @@ angle::Result ContextVk::initialize(const angle::ImageLoadContext &imageLoadCont
         buffer.init(mRenderer, kVertexBufferUsage, vk::kVertexBufferAlignment,
                     kDynamicVertexDataSize, true);
     }
+    mStreamedIndirectBuffer.init(mRenderer, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, sizeof(uint32_t),
+                                 kDynamicIndirectDataSize, true);
 
 #if ANGLE_ENABLE_VULKAN_GPU_TRACE_EVENTS
     angle::PlatformMethods *platform = ANGLEPlatformCurrent();
@@ -1560,6 +1589,7 @@ angle::Result ContextVk::finish(const gl::Context *context)
 angle::Result ContextVk::onFramebufferBoundary(const gl::Context *contextGL)
 {
     mShareGroupVk->onFramebufferBoundary();
+    mRenderPassCache.onFramebufferBoundary(this);
     return mRenderer->syncPipelineCacheVk(this, mRenderer->getGlobalOps(), contextGL);
 }
 
@@ -1614,13 +1644,28 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
 
     if (dirtyBits.any())
     {
-        // Flush any relevant dirty bits.
-        for (DirtyBits::Iterator dirtyBitIter = dirtyBits.begin(); dirtyBitIter != dirtyBits.end();
-             ++dirtyBitIter)
+        // The most frequent state changes between draw calls only modify the default uniforms or
+        // the vertex buffer bindings.  In that case, the render pass is already started and nothing
+        // else needs processing, so the fused handlers are called directly instead of going
+        // through the generic dispatch loop.
+        if (dirtyBits == kUniformsOnlyDirtyBits)
         {
-            ASSERT(mGraphicsDirtyBitHandlers[*dirtyBitIter]);
-            ANGLE_TRY(
-                (this->*mGraphicsDirtyBitHandlers[*dirtyBitIter])(&dirtyBitIter, dirtyBitMask));
+            ANGLE_TRY(handleDirtyGraphicsUniformsOnly());
+        }
+        else if (dirtyBits == kVertexBuffersOnlyDirtyBits)
+        {
+            ANGLE_TRY(handleDirtyGraphicsVertexBuffers(nullptr, dirtyBitMask));
+        }
+        else
+        {
+            // Flush any relevant dirty bits.
+            for (DirtyBits::Iterator dirtyBitIter = dirtyBits.begin();
+                 dirtyBitIter != dirtyBits.end(); ++dirtyBitIter)
+            {
+                ASSERT(mGraphicsDirtyBitHandlers[*dirtyBitIter]);
+                ANGLE_TRY((this->*mGraphicsDirtyBitHandlers[*dirtyBitIter])(&dirtyBitIter,
+                                                                            dirtyBitMask));
+            }
         }
 
         // Reset the processed dirty bits, except for those that are expected to persist between
@@ -3105,10 +3150,22 @@ angle::Result ContextVk::handleDirtyComputeUniforms(DirtyBits::Iterator *dirtyBi
     return handleDirtyUniformsImpl(dirtyBitsIterator);
 }
 
+angle::Result ContextVk::handleDirtyGraphicsUniformsOnly()
+{
+    // Equivalent to handling DIRTY_BIT_UNIFORMS followed by the DIRTY_BIT_DESCRIPTOR_SETS it sets.
+    ASSERT(hasActiveRenderPass());
+    ANGLE_TRY(updateUniformsImpl());
+    return handleDirtyDescriptorSetsImpl(mRenderPassCommands, PipelineType::Graphics);
+}
+
 angle::Result ContextVk::handleDirtyUniformsImpl(DirtyBits::Iterator *dirtyBitsIterator)
 {
     dirtyBitsIterator->setLaterBit(DIRTY_BIT_DESCRIPTOR_SETS);
+    return updateUniformsImpl();
+}
 
+angle::Result ContextVk::updateUniformsImpl()
+{
     ProgramExecutableVk *executableVk = vk::GetImpl(mState.getProgramExecutable());
     TransformFeedbackVk *transformFeedbackVk =
         vk::SafeGetImpl(mState.getCurrentTransformFeedback());
@@ -3463,6 +3520,7 @@ void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQ
 
     mPerfCounters.descriptorSetCacheTotalSize                = 0;
     mPerfCounters.descriptorSetCacheKeySizeBytes             = 0;
+    mPerfCounters.descriptorSetCacheEvictions                = 0;
     mPerfCounters.uniformsAndXfbDescriptorSetCacheHits       = 0;
     mPerfCounters.uniformsAndXfbDescriptorSetCacheMisses     = 0;
     mPerfCounters.uniformsAndXfbDescriptorSetCacheTotalSize  = 0;
@@ -3505,6 +3563,9 @@ void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQ
         mPerfCounters.descriptorSetCacheTotalSize =
             uniCacheStats.getSize() + texCacheStats.getSize() + resCacheStats.getSize() +
             mVulkanCacheStats[VulkanCacheType::DriverUniformsDescriptors].getSize();
+        mPerfCounters.descriptorSetCacheEvictions = uniCacheStats.getEvictCount() +
+                                                    texCacheStats.getEvictCount() +
+                                                    resCacheStats.getEvictCount();
 
         mPerfCounters.descriptorSetCacheKeySizeBytes = 0;
 
@@ -3529,6 +3590,7 @@ void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQ
 
     // Return current drawFramebuffer's cache stats
     mPerfCounters.framebufferCacheSize = mShareGroupVk->getFramebufferCache().getSize();
+    mPerfCounters.renderPassCacheSize  = mRenderPassCache.getSize();
 
     mPerfCounters.pendingSubmissionGarbageObjects =
         static_cast<uint64_t>(mRenderer->getPendingSubmissionGarbageSize());
@@ -4321,6 +4383,13 @@ angle::Result ContextVk::multiDrawArrays(const gl::Context *context,
                                          const GLsizei *counts,
                                          GLsizei drawcount)
 {
+    bool batched = false;
+    ANGLE_TRY(multiDrawArraysBatched(context, mode, firsts, counts, nullptr, drawcount, &batched));
+    if (batched)
+    {
+        return angle::Result::Continue;
+    }
+
     return rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount);
 }
 
@@ -4331,6 +4400,14 @@ angle::Result ContextVk::multiDrawArraysInstanced(const gl::Context *context,
                                                   const GLsizei *instanceCounts,
                                                   GLsizei drawcount)
 {
+    bool batched = false;
+    ANGLE_TRY(multiDrawArraysBatched(context, mode, firsts, counts, instanceCounts, drawcount,
+                                     &batched));
+    if (batched)
+    {
+        return angle::Result::Continue;
+    }
+
     return rx::MultiDrawArraysInstancedGeneral(this, context, mode, firsts, counts, instanceCounts,
                                                drawcount);
 }
@@ -4417,6 +4494,14 @@ angle::Result ContextVk::multiDrawElements(const gl::Context *context,
                                            const GLvoid *const *indices,
                                            GLsizei drawcount)
 {
+    bool batched = false;
+    ANGLE_TRY(multiDrawElementsBatched(context, mode, counts, type, indices, nullptr, drawcount,
+                                       &batched));
+    if (batched)
+    {
+        return angle::Result::Continue;
+    }
+
     return rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount);
 }
 
@@ -4428,6 +4513,14 @@ angle::Result ContextVk::multiDrawElementsInstanced(const gl::Context *context,
                                                     const GLsizei *instanceCounts,
                                                     GLsizei drawcount)
 {
+    bool batched = false;
+    ANGLE_TRY(multiDrawElementsBatched(context, mode, counts, type, indices, instanceCounts,
+                                       drawcount, &batched));
+    if (batched)
+    {
+        return angle::Result::Continue;
+    }
+
     return rx::MultiDrawElementsInstancedGeneral(this, context, mode, counts, type, indices,
                                                  instanceCounts, drawcount);
 }
@@ -4531,6 +4624,118 @@ angle::Result ContextVk::multiDrawElementsIndirectHelper(const gl::Context *cont
     return angle::Result::Continue;
 }
 
+angle::Result ContextVk::multiDrawArraysBatched(const gl::Context *context,
+                                                gl::PrimitiveMode mode,
+                                                const GLint *firsts,
+                                                const GLsizei *counts,
+                                                const GLsizei *instanceCounts,
+                                                GLsizei drawcount,
+                                                bool *batchedOut)
+{
+    *batchedOut = false;
+    if (!CanBatchClientMultiDraw(this, getVertexArray(), mode, drawcount))
+    {
+        return angle::Result::Continue;
+    }
+
+    const size_t drawParamsSize      = sizeof(VkDrawIndirectCommand) * drawcount;
+    vk::BufferHelper *indirectBuffer = nullptr;
+    bool newBuffer                   = false;
+    ANGLE_TRY(mStreamedIndirectBuffer.allocate(this, drawParamsSize, &indirectBuffer, &newBuffer));
+    mHasInFlightStreamedIndirectBuffers = mHasInFlightStreamedIndirectBuffers || newBuffer;
+
+    VkDrawIndirectCommand *drawParams =
+        reinterpret_cast<VkDrawIndirectCommand *>(indirectBuffer->getMappedMemory());
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        drawParams[drawID].vertexCount   = counts[drawID];
+        drawParams[drawID].instanceCount = instanceCounts ? instanceCounts[drawID] : 1;
+        drawParams[drawID].firstVertex   = firsts[drawID];
+        drawParams[drawID].firstInstance = 0;
+    }
+    ANGLE_TRY(indirectBuffer->flush(mRenderer));
+
+    ANGLE_TRY(setupIndirectDraw(context, mode, mNonIndexedDirtyBitsMask, indirectBuffer));
+
+    mRenderPassCommandBuffer->drawIndirect(indirectBuffer->getBuffer(),
+                                           indirectBuffer->getOffset(), drawcount,
+                                           sizeof(VkDrawIndirectCommand));
+    gl::MarkShaderStorageUsage(context);
+
+    *batchedOut = true;
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::multiDrawElementsBatched(const gl::Context *context,
+                                                  gl::PrimitiveMode mode,
+                                                  const GLsizei *counts,
+                                                  gl::DrawElementsType type,
+                                                  const GLvoid *const *indices,
+                                                  const GLsizei *instanceCounts,
+                                                  GLsizei drawcount,
+                                                  bool *batchedOut)
+{
+    *batchedOut = false;
+
+    // Client-side index data and emulated uint8 indices are converted per draw.
+    VertexArrayVk *vertexArrayVk = getVertexArray();
+    if (!vertexArrayVk->getState().getElementArrayBuffer() ||
+        shouldConvertUint8VkIndexType(type) ||
+        !CanBatchClientMultiDraw(this, vertexArrayVk, mode, drawcount))
+    {
+        return angle::Result::Continue;
+    }
+
+    const GLuint typeShift   = gl::GetDrawElementsTypeShift(type);
+    const uintptr_t typeMask = (uintptr_t{1} << typeShift) - 1;
+
+    // Offsets that are not a multiple of the index size cannot be expressed as a first index.
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if ((reinterpret_cast<uintptr_t>(indices[drawID]) & typeMask) != 0)
+        {
+            return angle::Result::Continue;
+        }
+    }
+
+    const size_t drawParamsSize      = sizeof(VkDrawIndexedIndirectCommand) * drawcount;
+    vk::BufferHelper *indirectBuffer = nullptr;
+    bool newBuffer                   = false;
+    ANGLE_TRY(mStreamedIndirectBuffer.allocate(this, drawParamsSize, &indirectBuffer, &newBuffer));
+    mHasInFlightStreamedIndirectBuffers = mHasInFlightStreamedIndirectBuffers || newBuffer;
+
+    VkDrawIndexedIndirectCommand *drawParams =
+        reinterpret_cast<VkDrawIndexedIndirectCommand *>(indirectBuffer->getMappedMemory());
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        const uintptr_t offset = reinterpret_cast<uintptr_t>(indices[drawID]);
+
+        drawParams[drawID].indexCount    = counts[drawID];
+        drawParams[drawID].instanceCount = instanceCounts ? instanceCounts[drawID] : 1;
+        drawParams[drawID].firstIndex    = static_cast<uint32_t>(offset >> typeShift);
+        drawParams[drawID].vertexOffset  = 0;
+        drawParams[drawID].firstInstance = 0;
+    }
+    ANGLE_TRY(indirectBuffer->flush(mRenderer));
+
+    // The offsets are part of the draw parameters, so bind the element array buffer from its
+    // start.  The next direct draw rebinds it at its own offset.
+    mGraphicsDirtyBits.set(DIRTY_BIT_INDEX_BUFFER);
+    mCurrentIndexBufferOffset = 0;
+    mLastIndexBufferOffset    = reinterpret_cast<const void *>(angle::DirtyPointer);
+    vertexArrayVk->updateCurrentElementArrayBuffer();
+
+    ANGLE_TRY(setupIndexedIndirectDraw(context, mode, type, indirectBuffer));
+
+    mRenderPassCommandBuffer->drawIndexedIndirect(indirectBuffer->getBuffer(),
+                                                  indirectBuffer->getOffset(), drawcount,
+                                                  sizeof(VkDrawIndexedIndirectCommand));
+    gl::MarkShaderStorageUsage(context);
+
+    *batchedOut = true;
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::multiDrawArraysInstancedBaseInstance(const gl::Context *context,
                                                               gl::PrimitiveMode mode,
                                                               const GLint *firsts,
@@ -7821,6 +8026,13 @@ angle::Result ContextVk::flushAndSubmitCommands(const vk::Semaphore *signalSemap
         mHasInFlightStreamedVertexBuffers.reset();
     }
 
+    if (mHasInFlightStreamedIndirectBuffers)
+    {
+        mStreamedIndirectBuffer.updateQueueSerialAndReleaseInFlightBuffers(this,
+                                                                           mLastFlushedQueueSerial);
+        mHasInFlightStreamedIndirectBuffers = false;
+    }
+
     ASSERT(mWaitSemaphores.empty());
     ASSERT(mWaitSemaphoreStageMasks.empty());
 
@@ -227,6 +227,25 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                                 GLsizei drawcount,
                                                 GLsizei stride);
 
+    // Client-side multi-draw helper functions.  When the draws can be batched, their parameters
+    // are streamed to an indirect buffer and issued with a single indirect draw command.
+    // Otherwise, *batchedOut is set to false and the caller falls back to a loop of draws.
+    angle::Result multiDrawArraysBatched(const gl::Context *context,
+                                         gl::PrimitiveMode mode,
+                                         const GLint *firsts,
+                                         const GLsizei *counts,
+                                         const GLsizei *instanceCounts,
+                                         GLsizei drawcount,
+                                         bool *batchedOut);
+    angle::Result multiDrawElementsBatched(const gl::Context *context,
+                                           gl::PrimitiveMode mode,
+                                           const GLsizei *counts,
+                                           gl::DrawElementsType type,
+                                           const GLvoid *const *indices,
+                                           const GLsizei *instanceCounts,
+                                           GLsizei drawcount,
+                                           bool *batchedOut);
+
     // ShareGroup
     ShareGroupVk *getShareGroup() { return mShareGroupVk; }
     PipelineLayoutCache &getPipelineLayoutCache()
@@ -1307,8 +1326,12 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     angle::Result handleDirtyComputeDescriptorSets(DirtyBits::Iterator *dirtyBitsIterator);
     angle::Result handleDirtyComputeUniforms(DirtyBits::Iterator *dirtyBitsIterator);
 
+    // Fused handler for when DIRTY_BIT_UNIFORMS is the only dirty bit.
+    angle::Result handleDirtyGraphicsUniformsOnly();
+
     // Common parts of the common dirty bit handlers.
     angle::Result handleDirtyUniformsImpl(DirtyBits::Iterator *dirtyBitsIterator);
+    angle::Result updateUniformsImpl();
     angle::Result handleDirtyMemoryBarrierImpl(DirtyBits::Iterator *dirtyBitsIterator,
                                                DirtyBits dirtyBitMask);
     template <typename CommandBufferT>
@@ -1533,6 +1556,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                                                   DIRTY_BIT_DESCRIPTOR_SETS};
     static constexpr DirtyBits kXfbBuffersAndDescSetDirtyBits{DIRTY_BIT_TRANSFORM_FEEDBACK_BUFFERS,
                                                               DIRTY_BIT_DESCRIPTOR_SETS};
+    // Dirty bits that are handled by fused fast paths in setupDraw when set on their own.
+    static constexpr DirtyBits kUniformsOnlyDirtyBits{DIRTY_BIT_UNIFORMS};
+    static constexpr DirtyBits kVertexBuffersOnlyDirtyBits{DIRTY_BIT_VERTEX_BUFFERS};
 
     // The offset we had the last time we bound the index buffer.
     const GLvoid *mLastIndexBufferOffset;
@@ -1587,6 +1613,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     gl::AttribArray<vk::DynamicBuffer> mStreamedVertexBuffers;
     gl::AttributesMask mHasInFlightStreamedVertexBuffers;
 
+    // DynamicBuffer for the draw parameters of batched client-side multi-draws.
+    vk::DynamicBuffer mStreamedIndirectBuffer;
+    bool mHasInFlightStreamedIndirectBuffers;
+
     // We use a single pool for recording commands. We also keep a free list for pool recycling.
     vk::SecondaryCommandPools mCommandPools;
 
@@ -621,6 +621,7 @@ angle::Result ProgramInfo::initProgram(vk::ErrorContext *context,
 
     options.useSpirvVaryingPrecisionFixer =
         context->getFeatures().varyingsRequireMatchingPrecisionInSpirv.enabled;
+    options.optimize = context->getFeatures().optimizeSpirv.enabled;
 
     ANGLE_TRY(
         SpvTransformSpirvCode(options, variableInfoMap, originalSpirvBlob, &transformedSpirvBlob));
@@ -37,6 +37,10 @@ constexpr double kMonolithicPipelineJobPeriod = 0.002;
 // Time interval in seconds that we should try to prune default buffer pools.
 constexpr double kTimeElapsedForPruneDefaultBufferPool = 0.25;
 
+// Frame interval at which descriptor set caches are trimmed of descriptor sets that have not been
+// used recently.
+constexpr uint32_t kDescriptorSetCacheTrimFrameInterval = 16;
+
 bool ValidateIdenticalPriority(const egl::ContextMap &contexts, egl::ContextPriority sharedPriority)
 {
     if (sharedPriority == egl::ContextPriority::InvalidEnum)
@@ -292,6 +296,17 @@ void ShareGroupVk::onFramebufferBoundary()
     // Always clean up event garbage and destroy the excessive free list at frame boundary.
     cleanupRefCountedEventGarbage();
 
+    // Descriptor set caches are otherwise only trimmed when allocation fails, which lets the sets
+    // of programs that are no longer used keep their pools alive indefinitely.
+    if (mRenderer->getFeatures().descriptorSetCache.enabled &&
+        (mCurrentFrameCount % kDescriptorSetCacheTrimFrameInterval) == 0)
+    {
+        for (vk::MetaDescriptorPool &descriptorPool : mMetaDescriptorPools)
+        {
+            descriptorPool.trimStaleDescriptorSets(mRenderer, mCurrentFrameCount);
+        }
+    }
+
     mCurrentFrameCount++;
 }
 
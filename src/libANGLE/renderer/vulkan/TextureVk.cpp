@@ -1075,6 +1075,17 @@ angle::Result TextureVk::ensureImageInitializedIfUpdatesNeedStageOrFlush(
         updateMustBeFlushed(level, vkFormat.getActualImageFormatID(getRequiredImageAccess()));
     bool mustStage = applyUpdate == vk::ApplyImageUpdate::Defer;
 
+    // If the application keeps uploading data to a texture that is not used yet, flush the staged
+    // updates once they hold too much memory instead of waiting for the texture to be used.  The
+    // image can only be created early if the base level is defined.
+    if (mustStage && mImage->isStagedBufferUpdateSizeOverBudget() &&
+        (mImage->valid() || mState.getBaseLevelDesc().format.valid()))
+    {
+        ANGLE_VK_PERF_WARNING(contextVk, GL_DEBUG_SEVERITY_LOW,
+                              "Flushing staged texture updates early due to their size");
+        mustFlush = true;
+    }
+
     // If texture has all levels being specified, then do the flush immediately. This tries to avoid
     // issue flush as each level is being provided which may end up flushing out the staged clear
     // that otherwise might able to be removed. It also helps tracking all updates with just one
@@ -2582,7 +2593,8 @@ angle::Result TextureVk::generateMipmapsWithCompute(ContextVk *contextVk)
     ANGLE_TRY(renderer->getSamplerCache().getSampler(contextVk, samplerDesc, &sampler));
 
     // If the image has more levels than supported, generate as many mips as possible at a time.
-    const vk::LevelIndex maxGenerateLevels(UtilsVk::GetGenerateMipmapMaxLevels(contextVk));
+    const vk::LevelIndex maxGenerateLevels(
+        UtilsVk::GetGenerateMipmapMaxLevels(contextVk->getRenderer()));
     vk::LevelIndex dstMaxLevelVk = mImage->toVkLevel(gl::LevelIndex(mState.getMipmapMaxLevel()));
     for (vk::LevelIndex dstBaseLevelVk =
              mImage->toVkLevel(gl::LevelIndex(mState.getEffectiveBaseLevel() + 1));
@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/vulkan/UtilsVk.h"
 
 #include "common/spirv/spirv_instruction_builder_autogen.h"
+#include "common/system_utils.h"
 
 #include "libANGLE/renderer/vulkan/ContextVk.h"
 #include "libANGLE/renderer/vulkan/FramebufferVk.h"
@@ -68,6 +69,34 @@ constexpr uint32_t kGenerateMipmapSourceBinding      = 1;
 
 constexpr uint32_t kGenerateFragmentShadingRateAttachmentBinding = 0;
 
+// Descriptor set layouts of the functions that are warmed up by UtilsVk::WarmUpPipelines.  They are
+// shared with the ensure*ResourcesInitialized functions so that the warmed up pipelines are created
+// with identical pipeline layouts.
+constexpr VkDescriptorPoolSize kConvertIndexSetSizes[2] = {
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
+};
+
+constexpr VkDescriptorPoolSize kConvertIndexIndirectSetSizes[4] = {
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // dst index buffer
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // source index buffer
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // src indirect buffer
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // dst indirect buffer
+};
+
+constexpr VkDescriptorPoolSize kConvertIndexIndirectLineLoopSetSizes[4] = {
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // cmd buffer
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // dst cmd buffer
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // source index buffer
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // dst index buffer
+};
+
+constexpr VkDescriptorPoolSize kConvertIndirectLineLoopSetSizes[3] = {
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // cmd buffer
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // dst cmd buffer
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // dst index buffer
+};
+
 bool ValidateFloatOneAsUint()
 {
     union
@@ -264,6 +293,106 @@ uint32_t GetBlitResolveFlags(bool blitColor,
     }
 }
 
+void GetGenerateMipmapSetSizes(vk::Renderer *renderer, VkDescriptorPoolSize setSizesOut[2])
+{
+    setSizesOut[0] = {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                      UtilsVk::GetGenerateMipmapMaxLevels(renderer)};
+    setSizesOut[1] = {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1};
+}
+
+void InitInternalPipelineLayoutDesc(VkShaderStageFlags descStages,
+                                    const VkDescriptorPoolSize *setSizes,
+                                    size_t setSizesCount,
+                                    size_t pushConstantsSize,
+                                    vk::DescriptorSetLayoutDesc *descriptorSetDescOut,
+                                    vk::PipelineLayoutDesc *pipelineLayoutDescOut)
+{
+    uint32_t currentBinding = 0;
+    for (size_t i = 0; i < setSizesCount; ++i)
+    {
+        descriptorSetDescOut->addBinding(currentBinding, setSizes[i].type,
+                                         setSizes[i].descriptorCount, descStages, nullptr);
+        ++currentBinding;
+    }
+
+    pipelineLayoutDescOut->updateDescriptorSetLayout(DescriptorSetIndex::Internal,
+                                                     *descriptorSetDescOut);
+    if (pushConstantsSize)
+    {
+        pipelineLayoutDescOut->updatePushConstantRange(descStages, 0,
+                                                       static_cast<uint32_t>(pushConstantsSize));
+    }
+}
+
+// Creates the pipelines of internal compute functions into the renderer's pipeline cache, which is
+// persisted through the blob cache.  The pipelines themselves, along with the shaders and layouts
+// they are created with, are thrown away; the point is for the contexts that later use these
+// functions to hit in the pipeline cache.
+class InternalPipelineWarmUp final : angle::NonCopyable
+{
+  public:
+    explicit InternalPipelineWarmUp(vk::ErrorContext *context) : mContext(context) {}
+    ~InternalPipelineWarmUp()
+    {
+        vk::Renderer *renderer = mContext->getRenderer();
+        mPipelineLayoutCache.destroy(renderer);
+        mDescriptorSetLayoutCache.destroy(renderer);
+        mShaderLibrary.destroy(renderer->getDevice());
+    }
+
+    angle::Result init()
+    {
+        return mContext->getRenderer()->getPipelineCache(mContext, &mPipelineCache);
+    }
+
+    vk::ShaderLibrary &getShaderLibrary() { return mShaderLibrary; }
+
+    angle::Result warmUpComputePipeline(const VkDescriptorPoolSize *setSizes,
+                                        size_t setSizesCount,
+                                        size_t pushConstantsSize,
+                                        const vk::ShaderModulePtr &shader)
+    {
+        vk::DescriptorSetLayoutDesc descriptorSetDesc;
+        vk::PipelineLayoutDesc pipelineLayoutDesc;
+        InitInternalPipelineLayoutDesc(VK_SHADER_STAGE_COMPUTE_BIT, setSizes, setSizesCount,
+                                       pushConstantsSize, &descriptorSetDesc,
+                                       &pipelineLayoutDesc);
+
+        vk::DescriptorSetLayoutPointerArray descriptorSetLayouts;
+        ANGLE_TRY(mDescriptorSetLayoutCache.getDescriptorSetLayout(
+            mContext, descriptorSetDesc, &descriptorSetLayouts[DescriptorSetIndex::Internal]));
+
+        vk::PipelineLayoutPtr pipelineLayout;
+        ANGLE_TRY(mPipelineLayoutCache.getPipelineLayout(mContext, pipelineLayoutDesc,
+                                                         descriptorSetLayouts, &pipelineLayout));
+
+        // Contexts use robust or protected pipelines only when created as such, so only the common
+        // variant is warmed up.
+        vk::ShaderProgramHelper program;
+        ComputePipelineCache pipelines;
+        program.setShader(gl::ShaderType::Compute, shader);
+
+        vk::PipelineHelper *pipeline = nullptr;
+        angle::Result result         = program.getOrCreateComputePipeline(
+            mContext, &pipelines, &mPipelineCache, *pipelineLayout,
+            vk::GetComputePipelineOptions(vk::PipelineRobustness::NonRobust,
+                                          vk::PipelineProtectedAccess::Unprotected),
+            PipelineSource::WarmUp, &pipeline, nullptr, nullptr);
+
+        pipelines.destroy(mContext);
+        program.destroy(mContext->getRenderer());
+
+        return result;
+    }
+
+  private:
+    vk::ErrorContext *mContext;
+    vk::PipelineCacheAccess mPipelineCache;
+    vk::ShaderLibrary mShaderLibrary;
+    DescriptorSetLayoutCache mDescriptorSetLayoutCache;
+    PipelineLayoutCache mPipelineLayoutCache;
+};
+
 uint32_t GetConvertIndexIndirectLineLoopFlag(uint32_t indicesBitsWidth)
 {
     switch (indicesBitsWidth)
@@ -280,13 +409,13 @@ uint32_t GetConvertIndexIndirectLineLoopFlag(uint32_t indicesBitsWidth)
     }
 }
 
-uint32_t GetGenerateMipmapFlags(ContextVk *contextVk, const angle::Format &actualFormat)
+uint32_t GetGenerateMipmapFlags(vk::Renderer *renderer, const angle::Format &actualFormat)
 {
     uint32_t flags = 0;
 
     // Note: If bits-per-component is 8 or 16 and float16 is supported in the shader, use that for
     // faster math.
-    const bool hasShaderFloat16 = contextVk->getFeatures().supportsShaderFloat16.enabled;
+    const bool hasShaderFloat16 = renderer->getFeatures().supportsShaderFloat16.enabled;
 
     if (actualFormat.redBits <= 8)
     {
@@ -303,7 +432,7 @@ uint32_t GetGenerateMipmapFlags(ContextVk *contextVk, const angle::Format &actua
         flags = GenerateMipmap_comp::kIsRGBA32F;
     }
 
-    flags |= UtilsVk::GetGenerateMipmapMaxLevels(contextVk) == UtilsVk::kGenerateMipmapMaxLevels
+    flags |= UtilsVk::GetGenerateMipmapMaxLevels(renderer) == UtilsVk::kGenerateMipmapMaxLevels
                  ? GenerateMipmap_comp::kDestSize6
                  : GenerateMipmap_comp::kDestSize4;
 
@@ -1262,10 +1391,8 @@ UtilsVk::ConvertVertexShaderParams::ConvertVertexShaderParams() = default;
 
 UtilsVk::ImageCopyShaderParams::ImageCopyShaderParams() = default;
 
-uint32_t UtilsVk::GetGenerateMipmapMaxLevels(ContextVk *contextVk)
+uint32_t UtilsVk::GetGenerateMipmapMaxLevels(vk::Renderer *renderer)
 {
-    vk::Renderer *renderer = contextVk->getRenderer();
-
     uint32_t maxPerStageDescriptorStorageImages =
         renderer->getPhysicalDeviceProperties().limits.maxPerStageDescriptorStorageImages;
 
@@ -1280,6 +1407,67 @@ uint32_t UtilsVk::GetGenerateMipmapMaxLevels(ContextVk *contextVk)
                : kGenerateMipmapMaxLevels;
 }
 
+// static
+angle::Result UtilsVk::WarmUpPipelines(vk::ErrorContext *context)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "UtilsVk::WarmUpPipelines");
+
+    vk::Renderer *renderer = context->getRenderer();
+
+    InternalPipelineWarmUp warmUp(context);
+    ANGLE_TRY(warmUp.init());
+
+    vk::ShaderLibrary &shaderLibrary = warmUp.getShaderLibrary();
+    vk::ShaderModulePtr shader;
+
+    // Index conversion, used for uint8 indices and line loops, with and without primitive restart.
+    for (uint32_t primitiveRestartFlag :
+         {0u, vk::InternalShader::ConvertIndex_comp::kIsPrimitiveRestartEnabled})
+    {
+        ANGLE_TRY(shaderLibrary.getConvertIndex_comp(context, primitiveRestartFlag, &shader));
+        ANGLE_TRY(warmUp.warmUpComputePipeline(kConvertIndexSetSizes,
+                                               ArraySize(kConvertIndexSetSizes),
+                                               sizeof(ConvertIndexShaderParams), shader));
+
+        ANGLE_TRY(shaderLibrary.getConvertIndex_comp(
+            context, primitiveRestartFlag | vk::InternalShader::ConvertIndex_comp::kIsIndirect,
+            &shader));
+        ANGLE_TRY(warmUp.warmUpComputePipeline(kConvertIndexIndirectSetSizes,
+                                               ArraySize(kConvertIndexIndirectSetSizes),
+                                               sizeof(ConvertIndexIndirectShaderParams), shader));
+    }
+
+    // Indirect line loops, for every index type.
+    for (uint32_t indicesBitsWidth : {8u, 16u, 32u})
+    {
+        ANGLE_TRY(shaderLibrary.getConvertIndexIndirectLineLoop_comp(
+            context, GetConvertIndexIndirectLineLoopFlag(indicesBitsWidth), &shader));
+        ANGLE_TRY(warmUp.warmUpComputePipeline(
+            kConvertIndexIndirectLineLoopSetSizes, ArraySize(kConvertIndexIndirectLineLoopSetSizes),
+            sizeof(ConvertIndexIndirectLineLoopShaderParams), shader));
+    }
+
+    ANGLE_TRY(shaderLibrary.getConvertIndirectLineLoop_comp(context, 0, &shader));
+    ANGLE_TRY(warmUp.warmUpComputePipeline(kConvertIndirectLineLoopSetSizes,
+                                           ArraySize(kConvertIndirectLineLoopSetSizes),
+                                           sizeof(ConvertIndirectLineLoopShaderParams), shader));
+
+    // Mipmap generation of 8-bit formats, by far the most common.
+    VkDescriptorPoolSize generateMipmapSetSizes[2];
+    GetGenerateMipmapSetSizes(renderer, generateMipmapSetSizes);
+    const uint32_t generateMipmapFlags = GetGenerateMipmapFlags(
+        renderer, angle::Format::Get(angle::FormatID::R8G8B8A8_UNORM));
+    ANGLE_TRY(shaderLibrary.getGenerateMipmap_comp(context, generateMipmapFlags, &shader));
+    ANGLE_TRY(warmUp.warmUpComputePipeline(generateMipmapSetSizes,
+                                           ArraySize(generateMipmapSetSizes),
+                                           sizeof(GenerateMipmapShaderParams), shader));
+
+    // The graphics pipelines (clears, blits, copies, etc) depend on the render pass and attachment
+    // formats of the framebuffer they are used with, which are not known in advance.
+
+    return angle::Result::Continue;
+}
+
 UtilsVk::UtilsVk() = default;
 
 UtilsVk::~UtilsVk() = default;
@@ -1289,6 +1477,16 @@ void UtilsVk::destroy(ContextVk *contextVk)
     vk::Renderer *renderer = contextVk->getRenderer();
     VkDevice device        = renderer->getDevice();
 
+    if (vk::kOutputCumulativePerfCounters)
+    {
+        INFO() << "UtilsVk first use latencies: ";
+        for (Function function : mUsedFunctions)
+        {
+            INFO() << "    Function " << ToUnderlying(function) << ": "
+                   << mFirstUseLatency[function] * 1000.0 << "ms";
+        }
+    }
+
     for (Function f : angle::AllEnums<Function>())
     {
         for (auto &descriptorSetLayout : mDescriptorSetLayouts[f])
@@ -1404,11 +1602,10 @@ void UtilsVk::destroy(ContextVk *contextVk)
 
 angle::Result UtilsVk::ensureResourcesInitialized(ContextVk *contextVk,
                                                   Function function,
-                                                  VkDescriptorPoolSize *setSizes,
+                                                  const VkDescriptorPoolSize *setSizes,
                                                   size_t setSizesCount,
                                                   size_t pushConstantsSize)
 {
-    vk::DescriptorSetLayoutDesc descriptorSetDesc;
     bool isCompute = function >= Function::ComputeStartIndex;
     VkShaderStageFlags descStages =
         isCompute ? VK_SHADER_STAGE_COMPUTE_BIT : VK_SHADER_STAGE_FRAGMENT_BIT;
@@ -1417,13 +1614,10 @@ angle::Result UtilsVk::ensureResourcesInitialized(ContextVk *contextVk,
         descStages |= VK_SHADER_STAGE_VERTEX_BIT;
     }
 
-    uint32_t currentBinding = 0;
-    for (size_t i = 0; i < setSizesCount; ++i)
-    {
-        descriptorSetDesc.addBinding(currentBinding, setSizes[i].type, setSizes[i].descriptorCount,
-                                     descStages, nullptr);
-        ++currentBinding;
-    }
+    vk::DescriptorSetLayoutDesc descriptorSetDesc;
+    vk::PipelineLayoutDesc pipelineLayoutDesc;
+    InitInternalPipelineLayoutDesc(descStages, setSizes, setSizesCount, pushConstantsSize,
+                                   &descriptorSetDesc, &pipelineLayoutDesc);
 
     ANGLE_TRY(contextVk->getDescriptorSetLayoutCache().getDescriptorSetLayout(
         contextVk, descriptorSetDesc,
@@ -1452,15 +1646,6 @@ angle::Result UtilsVk::ensureResourcesInitialized(ContextVk *contextVk,
     }
 
     // Corresponding pipeline layouts:
-    vk::PipelineLayoutDesc pipelineLayoutDesc;
-
-    pipelineLayoutDesc.updateDescriptorSetLayout(DescriptorSetIndex::Internal, descriptorSetDesc);
-    if (pushConstantsSize)
-    {
-        pipelineLayoutDesc.updatePushConstantRange(descStages, 0,
-                                                   static_cast<uint32_t>(pushConstantsSize));
-    }
-
     ANGLE_TRY(contextVk->getPipelineLayoutCache().getPipelineLayout(contextVk, pipelineLayoutDesc,
                                                                     mDescriptorSetLayouts[function],
                                                                     &mPipelineLayouts[function]));
@@ -1475,13 +1660,9 @@ angle::Result UtilsVk::ensureConvertIndexResourcesInitialized(ContextVk *context
         return angle::Result::Continue;
     }
 
-    VkDescriptorPoolSize setSizes[2] = {
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
-    };
-
-    return ensureResourcesInitialized(contextVk, Function::ConvertIndexBuffer, setSizes,
-                                      ArraySize(setSizes), sizeof(ConvertIndexShaderParams));
+    return ensureResourcesInitialized(contextVk, Function::ConvertIndexBuffer,
+                                      kConvertIndexSetSizes, ArraySize(kConvertIndexSetSizes),
+                                      sizeof(ConvertIndexShaderParams));
 }
 
 angle::Result UtilsVk::ensureConvertIndexIndirectResourcesInitialized(ContextVk *contextVk)
@@ -1491,15 +1672,9 @@ angle::Result UtilsVk::ensureConvertIndexIndirectResourcesInitialized(ContextVk
         return angle::Result::Continue;
     }
 
-    VkDescriptorPoolSize setSizes[4] = {
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // dst index buffer
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // source index buffer
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // src indirect buffer
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // dst indirect buffer
-    };
-
-    return ensureResourcesInitialized(contextVk, Function::ConvertIndexIndirectBuffer, setSizes,
-                                      ArraySize(setSizes),
+    return ensureResourcesInitialized(contextVk, Function::ConvertIndexIndirectBuffer,
+                                      kConvertIndexIndirectSetSizes,
+                                      ArraySize(kConvertIndexIndirectSetSizes),
                                       sizeof(ConvertIndexIndirectShaderParams));
 }
 
@@ -1510,15 +1685,9 @@ angle::Result UtilsVk::ensureConvertIndexIndirectLineLoopResourcesInitialized(Co
         return angle::Result::Continue;
     }
 
-    VkDescriptorPoolSize setSizes[4] = {
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // cmd buffer
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // dst cmd buffer
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // source index buffer
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // dst index buffer
-    };
-
     return ensureResourcesInitialized(contextVk, Function::ConvertIndexIndirectLineLoopBuffer,
-                                      setSizes, ArraySize(setSizes),
+                                      kConvertIndexIndirectLineLoopSetSizes,
+                                      ArraySize(kConvertIndexIndirectLineLoopSetSizes),
                                       sizeof(ConvertIndexIndirectLineLoopShaderParams));
 }
 
@@ -1529,14 +1698,9 @@ angle::Result UtilsVk::ensureConvertIndirectLineLoopResourcesInitialized(Context
         return angle::Result::Continue;
     }
 
-    VkDescriptorPoolSize setSizes[3] = {
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // cmd buffer
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // dst cmd buffer
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},  // dst index buffer
-    };
-
-    return ensureResourcesInitialized(contextVk, Function::ConvertIndirectLineLoopBuffer, setSizes,
-                                      ArraySize(setSizes),
+    return ensureResourcesInitialized(contextVk, Function::ConvertIndirectLineLoopBuffer,
+                                      kConvertIndirectLineLoopSetSizes,
+                                      ArraySize(kConvertIndirectLineLoopSetSizes),
                                       sizeof(ConvertIndirectLineLoopShaderParams));
 }
 
@@ -1714,10 +1878,8 @@ angle::Result UtilsVk::ensureGenerateMipmapResourcesInitialized(ContextVk *conte
         return angle::Result::Continue;
     }
 
-    VkDescriptorPoolSize setSizes[2] = {
-        {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, GetGenerateMipmapMaxLevels(contextVk)},
-        {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1},
-    };
+    VkDescriptorPoolSize setSizes[2];
+    GetGenerateMipmapSetSizes(contextVk->getRenderer(), setSizes);
 
     return ensureResourcesInitialized(contextVk, Function::GenerateMipmap, setSizes,
                                       ArraySize(setSizes), sizeof(GenerateMipmapShaderParams));
@@ -1832,6 +1994,9 @@ angle::Result UtilsVk::setupComputeProgram(
         programAndPipelines->program.setShader(gl::ShaderType::Compute, csShader);
     }
 
+    const bool isFirstUse  = !mUsedFunctions[function];
+    const double startTime = isFirstUse ? angle::GetCurrentSystemTime() : 0.0;
+
     vk::PipelineHelper *pipeline;
     vk::PipelineCacheAccess pipelineCache;
     ANGLE_TRY(renderer->getPipelineCache(contextVk, &pipelineCache));
@@ -1842,6 +2007,11 @@ angle::Result UtilsVk::setupComputeProgram(
         PipelineSource::Utils, &pipeline, nullptr, nullptr));
     commandBufferHelper->retainResource(pipeline);
 
+    if (isFirstUse)
+    {
+        onFirstUse(function, startTime);
+    }
+
     vk::OutsideRenderPassCommandBuffer *commandBuffer = &commandBufferHelper->getCommandBuffer();
     commandBuffer->bindComputePipeline(pipeline->getPipeline());
 
@@ -1943,9 +2113,25 @@ angle::Result UtilsVk::setupGraphicsProgram(ContextVk *contextVk,
 {
     ASSERT(function < Function::ComputeStartIndex);
 
-    return setupGraphicsProgramWithLayout(
+    const bool isFirstUse  = !mUsedFunctions[function];
+    const double startTime = isFirstUse ? angle::GetCurrentSystemTime() : 0.0;
+
+    ANGLE_TRY(setupGraphicsProgramWithLayout(
         contextVk, *mPipelineLayouts[function], vsShader, fsShader, programAndPipelines,
-        pipelineDesc, descriptorSet, pushConstants, pushConstantsSize, commandBuffer);
+        pipelineDesc, descriptorSet, pushConstants, pushConstantsSize, commandBuffer));
+
+    if (isFirstUse)
+    {
+        onFirstUse(function, startTime);
+    }
+
+    return angle::Result::Continue;
+}
+
+void UtilsVk::onFirstUse(Function function, double startTime)
+{
+    mUsedFunctions.set(function);
+    mFirstUseLatency[function] = angle::GetCurrentSystemTime() - startTime;
 }
 
 angle::Result UtilsVk::convertIndexBuffer(ContextVk *contextVk,
@@ -4110,7 +4296,7 @@ angle::Result UtilsVk::generateMipmap(ContextVk *contextVk,
     shaderParams.invSrcExtent[1] = 1.0f / srcExtents.height;
     shaderParams.levelCount      = params.dstLevelCount;
 
-    uint32_t flags = GetGenerateMipmapFlags(contextVk, src->getActualFormat());
+    uint32_t flags = GetGenerateMipmapFlags(contextVk->getRenderer(), src->getActualFormat());
 
     vk::OutsideRenderPassCommandBufferHelper *commandBufferHelper;
     ANGLE_TRY(contextVk->getOutsideRenderPassCommandBufferHelper({}, &commandBufferHelper));
@@ -4135,7 +4321,7 @@ angle::Result UtilsVk::generateMipmap(ContextVk *contextVk,
     writeInfos[0].sType                = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
     writeInfos[0].dstSet               = descriptorSet;
     writeInfos[0].dstBinding           = kGenerateMipmapDestinationBinding;
-    writeInfos[0].descriptorCount      = GetGenerateMipmapMaxLevels(contextVk);
+    writeInfos[0].descriptorCount      = GetGenerateMipmapMaxLevels(contextVk->getRenderer());
     writeInfos[0].descriptorType       = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
     writeInfos[0].pImageInfo           = destImageInfos;
 
@@ -43,6 +43,12 @@ class UtilsVk : angle::NonCopyable
 
     void destroy(ContextVk *contextVk);
 
+    // Creates the pipelines of commonly used compute functions (index conversion and mipmap
+    // generation) into the renderer's pipeline cache, so that their first use in a context is not
+    // slowed down by shader compilation.  Does not depend on any context, and may be called from a
+    // worker thread.
+    static angle::Result WarmUpPipelines(vk::ErrorContext *context);
+
     struct ConvertIndexParameters
     {
         uint32_t srcOffset = 0;
@@ -232,7 +238,7 @@ class UtilsVk : angle::NonCopyable
 
     // Based on the maximum number of levels in GenerateMipmap.comp.
     static constexpr uint32_t kGenerateMipmapMaxLevels = 6;
-    static uint32_t GetGenerateMipmapMaxLevels(ContextVk *contextVk);
+    static uint32_t GetGenerateMipmapMaxLevels(vk::Renderer *renderer);
 
     angle::Result convertIndexBuffer(ContextVk *contextVk,
                                      vk::BufferHelper *dst,
@@ -617,6 +623,9 @@ class UtilsVk : angle::NonCopyable
                                        size_t pushConstantsSize,
                                        vk::RenderPassCommandBuffer *commandBuffer);
 
+    // Records the first-use latency of a function, given the time its pipeline setup started.
+    void onFirstUse(Function function, double startTime);
+
     // Initializes descriptor set layout, pipeline layout and descriptor pool corresponding to given
     // function, if not already initialized.  Uses setSizes to create the layout.  For example, if
     // this array has two entries {STORAGE_TEXEL_BUFFER, 1} and {UNIFORM_TEXEL_BUFFER, 3}, then the
@@ -624,7 +633,7 @@ class UtilsVk : angle::NonCopyable
     // uniform texel buffer.  All resources are put in set 0.
     angle::Result ensureResourcesInitialized(ContextVk *contextVk,
                                              Function function,
-                                             VkDescriptorPoolSize *setSizes,
+                                             const VkDescriptorPoolSize *setSizes,
                                              size_t setSizesCount,
                                              size_t pushConstantsSize);
 
@@ -748,6 +757,12 @@ class UtilsVk : angle::NonCopyable
 
     vk::Sampler mPointSampler;
     vk::Sampler mLinearSampler;
+
+    // The time taken to set up the pipeline on the first use of each function in this context,
+    // which includes creating the pipeline.  Logged when the context is destroyed if perf counter
+    // output is enabled, to measure the first-use latency of each function.
+    angle::PackedEnumBitSet<Function, uint64_t> mUsedFunctions;
+    angle::PackedEnumMap<Function, double> mFirstUseLatency;
 };
 
 // This class' responsibility is to create index buffers needed to support line loops in Vulkan.
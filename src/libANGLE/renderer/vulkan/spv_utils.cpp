@@ -24,6 +24,10 @@
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 #include "libANGLE/trace.h"
 
+#if defined(ANGLE_ENABLE_VULKAN_SPIRV_OPTIMIZER)
+#    include <spirv-tools/optimizer.hpp>
+#endif
+
 namespace spirv = angle::spirv;
 
 namespace rx
@@ -5409,6 +5413,59 @@ void SpirvVertexAttributeAliasingTransformer::writeExpandedMatrixInitialization(
         spirv::WriteStore(mSpirvBlobOut, matrixId, compositeId, nullptr);
     }
 }
+
+// Runs the spirv-tools optimizer on the fully transformed SPIR-V.  This is done after the
+// transformation so that the optimizer never sees (and cannot invalidate) the ANGLE-specific ids
+// and non-semantic instructions the transformer relies on.  On failure, the input is left as is;
+// the unoptimized SPIR-V is still valid.
+void OptimizeSpirv(spirv::Blob *spirvBlob)
+{
+#if defined(ANGLE_ENABLE_VULKAN_SPIRV_OPTIMIZER)
+    ANGLE_TRACE_EVENT0("gpu.angle", "OptimizeSpirv");
+
+    const spv_target_env targetEnv =
+        (*spirvBlob)[spirv::kHeaderIndexVersion] == spirv::kVersion_1_4
+            ? SPV_ENV_VULKAN_1_1_SPIRV_1_4
+            : SPV_ENV_VULKAN_1_1;
+
+    spvtools::Optimizer optimizer(targetEnv);
+
+    // Inline everything into main, then promote function-local variables (including the
+    // parameters and return values of the inlined functions) to SSA values.
+    optimizer.RegisterPass(spvtools::CreateWrapOpKillPass())
+        .RegisterPass(spvtools::CreateDeadBranchElimPass())
+        .RegisterPass(spvtools::CreateMergeReturnPass())
+        .RegisterPass(spvtools::CreateInlineExhaustivePass())
+        .RegisterPass(spvtools::CreateEliminateDeadFunctionsPass())
+        .RegisterPass(spvtools::CreatePrivateToLocalPass())
+        .RegisterPass(spvtools::CreateLocalAccessChainConvertPass())
+        .RegisterPass(spvtools::CreateScalarReplacementPass())
+        .RegisterPass(spvtools::CreateLocalSingleBlockLoadStoreElimPass())
+        .RegisterPass(spvtools::CreateLocalSingleStoreElimPass())
+        .RegisterPass(spvtools::CreateLocalMultiStoreElimPass())
+        // Propagate constants and drop the code they make dead.  Interface variables are
+        // preserved so that the stage interfaces keep matching the other stages of the program.
+        .RegisterPass(spvtools::CreateCCPPass())
+        .RegisterPass(spvtools::CreateSimplificationPass())
+        .RegisterPass(spvtools::CreateDeadBranchElimPass())
+        .RegisterPass(spvtools::CreateBlockMergePass())
+        .RegisterPass(spvtools::CreateAggressiveDCEPass(true))
+        .RegisterPass(spvtools::CreateRedundancyEliminationPass())
+        .RegisterPass(spvtools::CreateAggressiveDCEPass(true));
+
+    spvtools::OptimizerOptions optimizerOptions;
+    optimizerOptions.set_run_validator(false);
+
+    spirv::Blob optimizedBlob;
+    if (!optimizer.Run(spirvBlob->data(), spirvBlob->size(), &optimizedBlob, optimizerOptions))
+    {
+        WARN() << "Failed to optimize SPIR-V; using the unoptimized code";
+        return;
+    }
+
+    *spirvBlob = std::move(optimizedBlob);
+#endif  // defined(ANGLE_ENABLE_VULKAN_SPIRV_OPTIMIZER)
+}
 }  // anonymous namespace
 
 SpvSourceOptions SpvCreateSourceOptions(const angle::FeaturesVk &features,
@@ -5643,6 +5700,11 @@ angle::Result SpvTransformSpirvCode(const SpvTransformOptions &options,
         aliasingTransformer.transform();
     }
 
+    if (options.optimize)
+    {
+        OptimizeSpirv(spirvBlobOut);
+    }
+
     spirvBlobOut->shrink_to_fit();
 
     if (options.validate)
@@ -53,6 +53,8 @@ struct SpvTransformOptions
     bool validate                       = true;
     bool useSpirvVaryingPrecisionFixer  = false;
     bool removeDepthStencilInput        = false;
+    // Run the spirv-tools optimizer on the result.  Ignored if built without the optimizer.
+    bool optimize = false;
 };
 
 struct ShaderInterfaceVariableXfbInfo
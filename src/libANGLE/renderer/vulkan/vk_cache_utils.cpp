@@ -5869,7 +5869,7 @@ angle::Result SamplerHelper::init(ContextVk *contextVk, const SamplerDesc &desc)
 }
 
 // RenderPassHelper implementation.
-RenderPassHelper::RenderPassHelper() : mPerfCounters{} {}
+RenderPassHelper::RenderPassHelper() : mPerfCounters{}, mLastUsedFrame(0) {}
 
 RenderPassHelper::~RenderPassHelper() = default;
 
@@ -5880,8 +5880,9 @@ RenderPassHelper::RenderPassHelper(RenderPassHelper &&other)
 
 RenderPassHelper &RenderPassHelper::operator=(RenderPassHelper &&other)
 {
-    mRenderPass   = std::move(other.mRenderPass);
-    mPerfCounters = std::move(other.mPerfCounters);
+    mRenderPass    = std::move(other.mRenderPass);
+    mPerfCounters  = std::move(other.mPerfCounters);
+    mLastUsedFrame = other.mLastUsedFrame;
     return *this;
 }
 
@@ -7379,7 +7380,7 @@ void FramebufferCache::erase(ContextVk *contextVk, const vk::FramebufferDesc &de
 }
 
 // RenderPassCache implementation.
-RenderPassCache::RenderPassCache() = default;
+RenderPassCache::RenderPassCache() : mCurrentFrame(0) {}
 
 RenderPassCache::~RenderPassCache()
 {
@@ -7423,6 +7424,70 @@ void RenderPassCache::clear(ContextVk *contextVk)
         }
     }
     mPayload.clear();
+    mCompatibleRenderPassCacheStats.setSize(0);
+    mRenderPassWithOpsCacheStats.setSize(0);
+}
+
+void RenderPassCache::onFramebufferBoundary(ContextVk *contextVk)
+{
+    // Render passes are small, but apps that render to many differently configured targets can
+    // create an unbounded number of them.
+    static constexpr uint32_t kMaxCachedRenderPasses = 256;
+
+    mCurrentFrame++;
+    if (mRenderPassWithOpsCacheStats.getSize() > kMaxCachedRenderPasses)
+    {
+        trim(contextVk);
+    }
+}
+
+void RenderPassCache::trim(ContextVk *contextVk)
+{
+    // Render passes used in the past kRenderPassRetireAge frames are kept even if the cache is over
+    // budget, as they are likely to be used again soon.
+    static constexpr uint32_t kRenderPassRetireAge = 10;
+    if (mCurrentFrame <= kRenderPassRetireAge)
+    {
+        return;
+    }
+    const uint32_t oldestFrameToKeep = mCurrentFrame - kRenderPassRetireAge;
+
+    bool waitedForPipelineCreationTask = false;
+    for (auto outerIt = mPayload.begin(); outerIt != mPayload.end();)
+    {
+        InnerCache &innerCache = outerIt->second;
+        for (auto innerIt = innerCache.begin(); innerIt != innerCache.end();)
+        {
+            if (innerIt->second.getLastUsedFrame() >= oldestFrameToKeep)
+            {
+                ++innerIt;
+                continue;
+            }
+
+            // Make sure there are no jobs referencing the render pass cache.
+            if (!waitedForPipelineCreationTask)
+            {
+                contextVk->getShareGroup()->waitForCurrentMonolithicPipelineCreationTask();
+                waitedForPipelineCreationTask = true;
+            }
+
+            // The render pass may still be in use by submitted commands, so it's released as
+            // garbage instead of destroyed.
+            innerIt->second.release(contextVk);
+            innerIt = innerCache.erase(innerIt);
+            mRenderPassWithOpsCacheStats.evictAndDecrementSize();
+        }
+
+        if (innerCache.empty())
+        {
+            outerIt = mPayload.erase(outerIt);
+            mCompatibleRenderPassCacheStats.evictAndDecrementSize();
+        }
+        else
+        {
+            ++outerIt;
+        }
+    }
 }
 
 // static
@@ -7492,7 +7557,7 @@ angle::Result RenderPassCache::getRenderPassWithOpsImpl(ContextVk *contextVk,
         auto innerIt = innerCache.find(attachmentOps);
         if (innerIt != innerCache.end())
         {
-            // TODO(jmadill): Could possibly use an MRU cache here.
+            innerIt->second.updateLastUsedFrame(mCurrentFrame);
             vk::GetRenderPassAndUpdateCounters(contextVk, updatePerfCounters, &innerIt->second,
                                                renderPassOut);
             mRenderPassWithOpsCacheStats.hit();
@@ -7503,6 +7568,7 @@ angle::Result RenderPassCache::getRenderPassWithOpsImpl(ContextVk *contextVk,
     {
         auto emplaceResult = mPayload.emplace(desc, InnerCache());
         outerIt            = emplaceResult.first;
+        mCompatibleRenderPassCacheStats.incrementSize();
     }
 
     mRenderPassWithOpsCacheStats.missAndIncrementSize();
@@ -7510,12 +7576,14 @@ angle::Result RenderPassCache::getRenderPassWithOpsImpl(ContextVk *contextVk,
     ANGLE_TRY(MakeRenderPass(contextVk, desc, attachmentOps, &newRenderPass.getRenderPass(),
                              &newRenderPass.getPerfCounters()));
 
+    newRenderPass.updateLastUsedFrame(mCurrentFrame);
+
     InnerCache &innerCache = outerIt->second;
     auto insertPos         = innerCache.emplace(attachmentOps, std::move(newRenderPass));
     vk::GetRenderPassAndUpdateCounters(contextVk, updatePerfCounters, &insertPos.first->second,
                                        renderPassOut);
 
-    // TODO(jmadill): Trim cache, and pre-populate with the most common RPs on startup.
+    // TODO(jmadill): Pre-populate with the most common RPs on startup.
     return angle::Result::Continue;
 }
 
@@ -2287,9 +2287,14 @@ class RenderPassHelper final : angle::NonCopyable
     const RenderPassPerfCounters &getPerfCounters() const;
     RenderPassPerfCounters &getPerfCounters();
 
+    void updateLastUsedFrame(uint32_t frame) { mLastUsedFrame = frame; }
+    uint32_t getLastUsedFrame() const { return mLastUsedFrame; }
+
   private:
     RenderPass mRenderPass;
     RenderPassPerfCounters mPerfCounters;
+    // Used by RenderPassCache to evict render passes that have not been used recently.
+    uint32_t mLastUsedFrame;
 };
 
 // Helper class manages the lifetime of various cache objects so that the cache entry can be
@@ -2448,14 +2453,18 @@ class CacheStats final : angle::NonCopyable
     ~CacheStats() {}
 
     CacheStats(const CacheStats &rhs)
-        : mHitCount(rhs.mHitCount), mMissCount(rhs.mMissCount), mSize(rhs.mSize)
+        : mHitCount(rhs.mHitCount),
+          mMissCount(rhs.mMissCount),
+          mEvictCount(rhs.mEvictCount),
+          mSize(rhs.mSize)
     {}
 
     CacheStats &operator=(const CacheStats &rhs)
     {
-        mHitCount  = rhs.mHitCount;
-        mMissCount = rhs.mMissCount;
-        mSize      = rhs.mSize;
+        mHitCount   = rhs.mHitCount;
+        mMissCount  = rhs.mMissCount;
+        mEvictCount = rhs.mEvictCount;
+        mSize       = rhs.mSize;
         return *this;
     }
 
@@ -2468,15 +2477,22 @@ class CacheStats final : angle::NonCopyable
         mMissCount++;
         mSize++;
     }
+    ANGLE_INLINE void evictAndDecrementSize()
+    {
+        mEvictCount++;
+        mSize--;
+    }
     ANGLE_INLINE void accumulate(const CacheStats &stats)
     {
         mHitCount += stats.mHitCount;
         mMissCount += stats.mMissCount;
+        mEvictCount += stats.mEvictCount;
         mSize += stats.mSize;
     }
 
     uint32_t getHitCount() const { return mHitCount; }
     uint32_t getMissCount() const { return mMissCount; }
+    uint32_t getEvictCount() const { return mEvictCount; }
 
     ANGLE_INLINE double getHitRatio() const
     {
@@ -2495,26 +2511,30 @@ class CacheStats final : angle::NonCopyable
 
     void reset()
     {
-        mHitCount  = 0;
-        mMissCount = 0;
-        mSize      = 0;
+        mHitCount   = 0;
+        mMissCount  = 0;
+        mEvictCount = 0;
+        mSize       = 0;
     }
 
     void resetHitAndMissCount()
     {
-        mHitCount  = 0;
-        mMissCount = 0;
+        mHitCount   = 0;
+        mMissCount  = 0;
+        mEvictCount = 0;
     }
 
     void accumulateCacheStats(VulkanCacheType cacheType, const CacheStats &cacheStats)
     {
         mHitCount += cacheStats.getHitCount();
         mMissCount += cacheStats.getMissCount();
+        mEvictCount += cacheStats.getEvictCount();
     }
 
   private:
     uint32_t mHitCount;
     uint32_t mMissCount;
+    uint32_t mEvictCount;
     uint32_t mSize;
 };
 
@@ -2563,7 +2583,8 @@ class FramebufferCache final : angle::NonCopyable
     CacheStats mCacheStats;
 };
 
-// TODO(jmadill): Add cache trimming/eviction.
+// Render passes are evicted in LRU order once the cache grows beyond a fixed budget.  Eviction only
+// happens at frame boundaries, where no pointer returned by the cache is held.
 class RenderPassCache final : angle::NonCopyable
 {
   public:
@@ -2573,6 +2594,9 @@ class RenderPassCache final : angle::NonCopyable
     void destroy(ContextVk *contextVk);
     void clear(ContextVk *contextVk);
 
+    // Advances the frame used for LRU tracking, and trims the cache if it is over budget.
+    void onFramebufferBoundary(ContextVk *contextVk);
+
     ANGLE_INLINE angle::Result getCompatibleRenderPass(ContextVk *contextVk,
                                                        const vk::RenderPassDesc &desc,
                                                        const vk::RenderPass **renderPassOut)
@@ -2584,12 +2608,14 @@ class RenderPassCache final : angle::NonCopyable
             ASSERT(!innerCache.empty());
 
             // Find the first element and return it.
-            *renderPassOut = &innerCache.begin()->second.getRenderPass();
+            vk::RenderPassHelper &renderPassHelper = innerCache.begin()->second;
+            renderPassHelper.updateLastUsedFrame(mCurrentFrame);
+            *renderPassOut = &renderPassHelper.getRenderPass();
             mCompatibleRenderPassCacheStats.hit();
             return angle::Result::Continue;
         }
 
-        mCompatibleRenderPassCacheStats.missAndIncrementSize();
+        mCompatibleRenderPassCacheStats.miss();
         return addCompatibleRenderPass(contextVk, desc, renderPassOut);
     }
 
@@ -2598,6 +2624,9 @@ class RenderPassCache final : angle::NonCopyable
                                        const vk::AttachmentOpsArray &attachmentOps,
                                        const vk::RenderPass **renderPassOut);
 
+    // Number of render passes in the cache.
+    size_t getSize() const { return mRenderPassWithOpsCacheStats.getSize(); }
+
     static void InitializeOpsForCompatibleRenderPass(const vk::RenderPassDesc &desc,
                                                      vk::AttachmentOpsArray *opsOut);
     static angle::Result MakeRenderPass(vk::ErrorContext *context,
@@ -2617,6 +2646,8 @@ class RenderPassCache final : angle::NonCopyable
                                           const vk::RenderPassDesc &desc,
                                           const vk::RenderPass **renderPassOut);
 
+    void trim(ContextVk *contextVk);
+
     // Use a two-layer caching scheme. The top level matches the "compatible" RenderPass elements.
     // The second layer caches the attachment load/store ops and initial/final layout.
     // Switch to `std::unordered_map` to retain pointer stability.
@@ -2626,6 +2657,9 @@ class RenderPassCache final : angle::NonCopyable
     OuterCache mPayload;
     CacheStats mCompatibleRenderPassCacheStats;
     CacheStats mRenderPassWithOpsCacheStats;
+
+    // Number of frames this cache has seen, used to track the last use of each render pass.
+    uint32_t mCurrentFrame;
 };
 
 enum class PipelineSource
@@ -1031,6 +1031,31 @@ const angle::Format &GetDepthStencilImageToBufferFormat(const angle::Format &ima
     }
 }
 
+// Returns the pack parameters to use when the rotation and y-flip of a readback have already been
+// applied to the source image.
+PackPixelsParams GetUntransformedReadPixelsParams(const PackPixelsParams &packPixelsParams)
+{
+    PackPixelsParams untransformedParams = packPixelsParams;
+    untransformedParams.rotation         = SurfaceRotation::Identity;
+    untransformedParams.reverseRowOrder  = false;
+    if (IsRotatedAspectRatio(packPixelsParams.rotation))
+    {
+        std::swap(untransformedParams.area.width, untransformedParams.area.height);
+    }
+    return untransformedParams;
+}
+
+VkExtent3D GetUntransformedReadPixelsExtent(const PackPixelsParams &packPixelsParams,
+                                            const VkExtent3D &srcExtent)
+{
+    VkExtent3D untransformedExtent = srcExtent;
+    if (IsRotatedAspectRatio(packPixelsParams.rotation))
+    {
+        std::swap(untransformedExtent.width, untransformedExtent.height);
+    }
+    return untransformedExtent;
+}
+
 VkClearValue GetRobustResourceClearValue(const angle::Format &intendedFormat,
                                          const angle::Format &actualFormat)
 {
@@ -4647,7 +4672,7 @@ bool DynamicDescriptorPool::evictStaleDescriptorSets(Renderer *renderer,
 
             // This should destroy descriptorSet, which is already invalid;
             it = decltype(it)(mLRUList.erase(std::next(it).base()));
-            mCacheStats.decrementSize();
+            mCacheStats.evictAndDecrementSize();
         }
         else
         {
@@ -4884,6 +4909,38 @@ void DynamicDescriptorPool::checkAndDestroyUnusedPool(Renderer *renderer)
     }
 }
 
+void DynamicDescriptorPool::trimStaleDescriptorSets(Renderer *renderer, uint32_t currentFrame)
+{
+    ASSERT(renderer->getFeatures().descriptorSetCache.enabled);
+    if (currentFrame > kDescriptorSetCacheRetireAge &&
+        evictStaleDescriptorSets(renderer, currentFrame - kDescriptorSetCacheRetireAge,
+                                 currentFrame))
+    {
+        // Eviction already released the pools that became empty.
+        return;
+    }
+
+    // Descriptor sets may also have been released because the resources they reference were
+    // deleted.  Release the pools that became empty that way.
+    checkAndDestroyUnusedPool(renderer);
+}
+
+bool DynamicDescriptorPool::isEmpty() const
+{
+    if (!mLRUList.empty())
+    {
+        return false;
+    }
+    for (const DescriptorPoolPointer &pool : mDescriptorPools)
+    {
+        if (!pool->canDestroy())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 // For ASSERT only
 bool DynamicDescriptorPool::hasCachedDescriptorSet(const DescriptorSetDesc &desc) const
 {
@@ -9048,6 +9105,22 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
         }
     }
 
+    // Color updates that extend the last staged update of the same subresource are written into
+    // that update's staging buffer instead of getting a staging allocation of their own.
+    if (!storageFormat.isBlock && !storageFormat.isYUV && stencilAllocationSize == 0 &&
+        GetFormatAspectFlags(storageFormat) == VK_IMAGE_ASPECT_COLOR_BIT &&
+        glExtents.depth == 1 && index.getLayerCount() == 1)
+    {
+        bool coalesced = false;
+        ANGLE_TRY(coalesceWithLastStagedBufferUpdate(
+            contextVk, index, glExtents, offset, storageFormat, loadFunctionInfo.loadFunction,
+            source, inputRowPitch, inputDepthPitch, &coalesced));
+        if (coalesced)
+        {
+            return angle::Result::Continue;
+        }
+    }
+
     std::unique_ptr<RefCounted<BufferHelper>> stagingBuffer =
         std::make_unique<RefCounted<BufferHelper>>();
     BufferHelper *currentBuffer = &stagingBuffer->get();
@@ -9184,6 +9257,165 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+angle::Result ImageHelper::coalesceWithLastStagedBufferUpdate(ContextVk *contextVk,
+                                                              const gl::ImageIndex &index,
+                                                              const gl::Extents &glExtents,
+                                                              const gl::Offset &offset,
+                                                              const angle::Format &storageFormat,
+                                                              LoadImageFunction loadFunction,
+                                                              const uint8_t *source,
+                                                              GLuint inputRowPitch,
+                                                              GLuint inputDepthPitch,
+                                                              bool *coalescedOut)
+{
+    // The staging buffer of coalesced updates is grown geometrically up to this size, after which
+    // a new update is started.
+    constexpr VkDeviceSize kMaxCoalescedStagingBufferSize = 256 * 1024;  // 256 KB
+
+    *coalescedOut = false;
+
+    const gl::LevelIndex updateLevelGL(index.getLevelIndex());
+    SubresourceUpdates *levelUpdates = getLevelUpdates(updateLevelGL);
+    if (levelUpdates == nullptr || levelUpdates->empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    // Only the last update can be extended, as writing into an earlier one would reorder it with
+    // respect to the updates that follow it.  Its staging buffer must not be shared with another
+    // update either.
+    SubresourceUpdate &lastUpdate = levelUpdates->back();
+    if (lastUpdate.updateSource != UpdateSource::Buffer ||
+        lastUpdate.refCounted.buffer == nullptr ||
+        lastUpdate.refCounted.buffer->getRefCount() != 1 ||
+        lastUpdate.data.buffer.formatID != storageFormat.id)
+    {
+        return angle::Result::Continue;
+    }
+
+    // Match the subresource the update would otherwise be staged to.
+    VkBufferImageCopy &lastCopy = lastUpdate.data.buffer.copyRegion;
+    const bool isArray          = gl::IsArrayTextureType(index.getType());
+    const int32_t layerIndex    = index.hasLayer() ? index.getLayerIndex() : 0;
+    const int32_t baseLayer     = isArray ? offset.z : layerIndex;
+    const int32_t offsetZ       = isArray ? 0 : offset.z;
+    if (lastCopy.imageSubresource.aspectMask != VK_IMAGE_ASPECT_COLOR_BIT ||
+        lastCopy.imageSubresource.mipLevel != static_cast<uint32_t>(updateLevelGL.get()) ||
+        lastCopy.imageSubresource.baseArrayLayer != static_cast<uint32_t>(baseLayer) ||
+        lastCopy.imageSubresource.layerCount != 1 || lastCopy.imageOffset.z != offsetZ ||
+        lastCopy.imageExtent.depth != 1)
+    {
+        return angle::Result::Continue;
+    }
+
+    const int32_t lastX       = lastCopy.imageOffset.x;
+    const int32_t lastY       = lastCopy.imageOffset.y;
+    const uint32_t lastWidth  = lastCopy.imageExtent.width;
+    const uint32_t lastHeight = lastCopy.imageExtent.height;
+    const uint32_t width      = static_cast<uint32_t>(glExtents.width);
+    const uint32_t height     = static_cast<uint32_t>(glExtents.height);
+
+    uint32_t dstX      = 0;
+    uint32_t dstY      = 0;
+    uint32_t newWidth  = lastWidth;
+    uint32_t newHeight = lastHeight;
+    if (offset.x >= lastX && offset.y >= lastY &&
+        offset.x + glExtents.width <= lastX + static_cast<int32_t>(lastWidth) &&
+        offset.y + glExtents.height <= lastY + static_cast<int32_t>(lastHeight))
+    {
+        // The update is within the last one; overwrite that part of its data.
+        dstX = static_cast<uint32_t>(offset.x - lastX);
+        dstY = static_cast<uint32_t>(offset.y - lastY);
+    }
+    else if (offset.y == lastY && height == lastHeight &&
+             offset.x == lastX + static_cast<int32_t>(lastWidth))
+    {
+        // The update continues the last one to the right.
+        dstX     = lastWidth;
+        newWidth = lastWidth + width;
+    }
+    else if (offset.x == lastX && width == lastWidth &&
+             offset.y == lastY + static_cast<int32_t>(lastHeight))
+    {
+        // The update continues the last one downwards.
+        dstY      = lastHeight;
+        newHeight = lastHeight + height;
+    }
+    else
+    {
+        return angle::Result::Continue;
+    }
+
+    const uint32_t pixelBytes   = storageFormat.pixelBytes;
+    BufferHelper *stagingBuffer = lastUpdate.data.buffer.bufferHelper;
+    uint32_t rowLength = lastCopy.bufferRowLength != 0 ? lastCopy.bufferRowLength : lastWidth;
+    const VkDeviceSize capacity =
+        stagingBuffer->getOffset() + stagingBuffer->getSize() - lastCopy.bufferOffset;
+    const VkDeviceSize rowCapacity = capacity / (static_cast<VkDeviceSize>(rowLength) * pixelBytes);
+
+    if (newWidth > rowLength || newHeight > rowCapacity)
+    {
+        // Reallocate the staging buffer with room to spare in the direction it is growing, so the
+        // data of a long run of updates is only copied a few times.
+        const uint32_t grownRowLength = newWidth > rowLength ? newWidth * 2 : rowLength;
+        const uint32_t grownRowCount  = newHeight > rowCapacity ? newHeight * 2 : newHeight;
+        const VkDeviceSize grownSize =
+            static_cast<VkDeviceSize>(grownRowLength) * grownRowCount * pixelBytes;
+        if (grownSize > kMaxCoalescedStagingBufferSize)
+        {
+            return angle::Result::Continue;
+        }
+
+        std::unique_ptr<RefCounted<BufferHelper>> grownBuffer =
+            std::make_unique<RefCounted<BufferHelper>>();
+        BufferHelper *grownBufferHelper = &grownBuffer->get();
+
+        uint8_t *grownData;
+        VkDeviceSize grownOffset;
+        ANGLE_TRY(contextVk->initBufferForImageCopy(
+            grownBufferHelper, static_cast<size_t>(grownSize), MemoryCoherency::CachedNonCoherent,
+            storageFormat.id, &grownOffset, &grownData));
+
+        const uint8_t *lastData = stagingBuffer->getBlockMemory() + lastCopy.bufferOffset;
+        for (uint32_t row = 0; row < lastHeight; ++row)
+        {
+            memcpy(grownData + static_cast<size_t>(row) * grownRowLength * pixelBytes,
+                   lastData + static_cast<size_t>(row) * rowLength * pixelBytes,
+                   static_cast<size_t>(lastWidth) * pixelBytes);
+        }
+
+        // Update total staging buffer size
+        mTotalStagedBufferUpdateSize -= stagingBuffer->getSize();
+        mTotalStagedBufferUpdateSize += grownBufferHelper->getSize();
+
+        // Let the update own the new staging buffer
+        lastUpdate.release(contextVk->getRenderer());
+        lastUpdate.refCounted.buffer = grownBuffer.release();
+        lastUpdate.refCounted.buffer->addRef();
+        lastUpdate.data.buffer.bufferHelper = grownBufferHelper;
+        lastCopy.bufferOffset               = grownOffset;
+        lastCopy.bufferRowLength            = grownRowLength;
+
+        stagingBuffer = grownBufferHelper;
+        rowLength     = grownRowLength;
+    }
+
+    const size_t dstRowPitch = static_cast<size_t>(rowLength) * pixelBytes;
+    uint8_t *dstData = stagingBuffer->getBlockMemory() + lastCopy.bufferOffset +
+                       dstY * dstRowPitch + dstX * pixelBytes;
+    loadFunction(contextVk->getImageLoadContext(), glExtents.width, glExtents.height, 1, source,
+                 inputRowPitch, inputDepthPitch, dstData, dstRowPitch,
+                 dstRowPitch * glExtents.height);
+
+    lastCopy.imageExtent.width  = newWidth;
+    lastCopy.imageExtent.height = newHeight;
+    lastCopy.bufferImageHeight  = newHeight;
+
+    onStateChange(angle::SubjectMessage::SubjectChanged);
+    *coalescedOut = true;
+    return angle::Result::Continue;
+}
+
 angle::Result ImageHelper::updateSubresourceOnHost(ErrorContext *context,
                                                    ApplyImageUpdate applyUpdate,
                                                    const gl::ImageIndex &index,
@@ -9351,8 +9583,11 @@ angle::Result ImageHelper::reformatStagedBufferUpdates(ContextVk *contextVk,
             {
                 const VkBufferImageCopy &copy = update.data.buffer.copyRegion;
 
-                // Source and dst data are tightly packed
-                GLuint srcDataRowPitch = copy.imageExtent.width * srcFormat.pixelBytes;
+                // Source data may have spare room at the end of each row if updates were
+                // coalesced into it.  Dst data is tightly packed.
+                GLuint srcDataRowPitch =
+                    (copy.bufferRowLength != 0 ? copy.bufferRowLength : copy.imageExtent.width) *
+                    srcFormat.pixelBytes;
                 GLuint dstDataRowPitch = copy.imageExtent.width * dstFormat.pixelBytes;
 
                 GLuint srcDataDepthPitch = srcDataRowPitch * copy.imageExtent.height;
@@ -9388,9 +9623,10 @@ angle::Result ImageHelper::reformatStagedBufferUpdates(ContextVk *contextVk,
                                   false);
 
                 // Replace srcBuffer with dstBuffer
-                update.data.buffer.bufferHelper            = dstBuffer;
-                update.data.buffer.formatID                = dstFormatID;
-                update.data.buffer.copyRegion.bufferOffset = dstBufferOffset;
+                update.data.buffer.bufferHelper               = dstBuffer;
+                update.data.buffer.formatID                   = dstFormatID;
+                update.data.buffer.copyRegion.bufferOffset    = dstBufferOffset;
+                update.data.buffer.copyRegion.bufferRowLength = copy.imageExtent.width;
 
                 // Update total staging buffer size
                 mTotalStagedBufferUpdateSize -= srcBuffer->getSize();
@@ -10978,6 +11214,12 @@ bool ImageHelper::hasStagedImageUpdatesWithMismatchedFormat(gl::LevelIndex level
     return false;
 }
 
+bool ImageHelper::isStagedBufferUpdateSizeOverBudget() const
+{
+    constexpr VkDeviceSize kStagedBufferUpdateSizeBudget = 64 * 1024 * 1024;  // 64 MB
+    return mTotalStagedBufferUpdateSize >= kStagedBufferUpdateSizeBudget;
+}
+
 bool ImageHelper::hasBufferSourcedStagedUpdatesInAllLevels() const
 {
     for (gl::LevelIndex level = mFirstAllocatedLevel; level <= getLastAllocatedLevel(); ++level)
@@ -11555,6 +11797,91 @@ angle::Result ImageHelper::readPixelsWithCompute(ContextVk *contextVk,
     return contextVk->getUtils().copyImageToBuffer(contextVk, &packBuffer, src, params);
 }
 
+angle::Result ImageHelper::transformWithDrawForReadPixels(
+    ContextVk *contextVk,
+    ImageHelper *src,
+    const PackPixelsParams &packPixelsParams,
+    const VkOffset3D &srcOffset,
+    const VkExtent3D &srcExtent,
+    const VkImageSubresourceLayers &srcSubresource,
+    ImageHelper *dst)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ImageHelper::transformWithDrawForReadPixels");
+
+    Renderer *renderer = contextVk->getRenderer();
+
+    const VkExtent3D dstExtent = GetUntransformedReadPixelsExtent(packPixelsParams, srcExtent);
+    ANGLE_TRY(dst->init2DStaging(
+        contextVk, contextVk->getState().hasProtectedContent(), renderer->getMemoryProperties(),
+        gl::Extents(dstExtent.width, dstExtent.height, 1), mIntendedFormatID, mActualFormatID,
+        VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+            VK_IMAGE_USAGE_SAMPLED_BIT,
+        1));
+
+    // Make sure the render pass is closed, per UtilsVk::copyImage's requirements.
+    ANGLE_TRY(
+        contextVk->flushCommandsAndEndRenderPass(RenderPassClosureReason::PrepareForImageCopy));
+
+    gl::TextureType textureType = Get2DTextureType(src->getLayerCount(), 1);
+
+    vk::ImageView srcView;
+    ANGLE_TRY(src->initLayerImageView(contextVk, textureType, VK_IMAGE_ASPECT_COLOR_BIT,
+                                      gl::SwizzleState(), &srcView,
+                                      vk::LevelIndex(srcSubresource.mipLevel), 1, 0,
+                                      src->getLayerCount()));
+    vk::ImageView dstView;
+    ANGLE_TRY(dst->initLayerImageView(contextVk, gl::TextureType::_2D, VK_IMAGE_ASPECT_COLOR_BIT,
+                                      gl::SwizzleState(), &dstView, vk::LevelIndex(0), 1, 0, 1));
+
+    // The destination texel at (x, y) takes the source texel that PackPixels would have written
+    // there, relative to the read area:
+    //
+    // - Identity, reverseRowOrder: (x, h - 1 - y)
+    // - 90 degrees:                (y, x)
+    // - 180 degrees:               (w - 1 - x, y)
+    // - 270 degrees:               (w - 1 - y, h - 1 - x)
+    //
+    // The offsets below account for how UtilsVk::copyImage derives the shader's source offset from
+    // the rotation and flip parameters.
+    UtilsVk::CopyImageParameters params = {};
+    params.srcOffset[0]                 = srcOffset.x;
+    params.srcOffset[1]                 = srcOffset.y;
+    params.srcExtents[0]                = srcExtent.width;
+    params.srcExtents[1]                = srcExtent.height;
+    params.srcLayer                     = srcSubresource.baseArrayLayer;
+    params.srcSampleCount               = 1;
+    params.srcHeight                    = srcExtent.height;
+    params.srcRotation                  = packPixelsParams.rotation;
+    switch (packPixelsParams.rotation)
+    {
+        case SurfaceRotation::Identity:
+            ASSERT(packPixelsParams.reverseRowOrder);
+            params.dstFlipY = true;
+            break;
+        case SurfaceRotation::Rotated90Degrees:
+            break;
+        case SurfaceRotation::Rotated180Degrees:
+            params.dstFlipY = true;
+            params.srcOffset[0] -= 1;
+            params.srcOffset[1] += 1;
+            break;
+        case SurfaceRotation::Rotated270Degrees:
+            params.srcOffset[0] -= 1;
+            params.srcOffset[1] -= 1;
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    ANGLE_TRY(contextVk->getUtils().copyImage(contextVk, dst, &dstView, src, &srcView, params));
+
+    contextVk->addGarbage(&srcView);
+    contextVk->addGarbage(&dstView);
+
+    return angle::Result::Continue;
+}
+
 bool ImageHelper::canCopyWithTransformForReadPixels(const PackPixelsParams &packPixelsParams,
                                                     const VkExtent3D &srcExtent,
                                                     const angle::Format *readFormat,
@@ -11620,6 +11947,44 @@ bool ImageHelper::canCopyWithComputeForReadPixels(const PackPixelsParams &packPi
            isPitchMultipleOfTexelSize && isOffsetMultipleOfUint && isRowLengthEnough;
 }
 
+bool ImageHelper::canTransformWithDrawForReadPixels(Renderer *renderer,
+                                                    const ImageHelper *src,
+                                                    const PackPixelsParams &packPixelsParams,
+                                                    const VkExtent3D &srcExtent,
+                                                    const angle::Format *readFormat,
+                                                    VkImageAspectFlagBits copyAspectFlags,
+                                                    ptrdiff_t pixelsOffset)
+{
+    ASSERT(mActualFormatID != angle::FormatID::NONE && mIntendedFormatID != angle::FormatID::NONE);
+
+    // Only worth it if there is a transformation to apply.
+    const bool needsTransformation =
+        packPixelsParams.rotation != SurfaceRotation::Identity || packPixelsParams.reverseRowOrder;
+
+    // The transformation is done by sampling the source and rendering to a staging image.
+    const bool isColor = copyAspectFlags == VK_IMAGE_ASPECT_COLOR_BIT;
+    const bool isSampleable2D = src->getType() == VK_IMAGE_TYPE_2D && src->getSamples() == 1 &&
+                                (src->getUsage() & VK_IMAGE_USAGE_SAMPLED_BIT) != 0 &&
+                                !src->getYcbcrConversionDesc().valid();
+    const bool isRenderable = renderer->hasImageFormatFeatureBits(
+        mActualFormatID, VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT);
+
+    if (!needsTransformation || !isColor || !isSampleable2D || !isRenderable ||
+        hasEmulatedImageFormat())
+    {
+        return false;
+    }
+
+    // The staging image must then be copyable to the PBO without the CPU.
+    const PackPixelsParams untransformedParams = GetUntransformedReadPixelsParams(packPixelsParams);
+    const VkExtent3D untransformedExtent =
+        GetUntransformedReadPixelsExtent(packPixelsParams, srcExtent);
+    return canCopyWithTransformForReadPixels(untransformedParams, untransformedExtent, readFormat,
+                                             pixelsOffset) ||
+           canCopyWithComputeForReadPixels(untransformedParams, untransformedExtent, readFormat,
+                                           pixelsOffset);
+}
+
 angle::Result ImageHelper::readPixels(ContextVk *contextVk,
                                       const gl::Rectangle &area,
                                       const PackPixelsParams &packPixelsParams,
@@ -11879,16 +12244,47 @@ angle::Result ImageHelper::readPixelsImpl(ContextVk *contextVk,
         srcSubresource.mipLevel       = 0;
     }
 
-    // If PBO and if possible, copy directly on the GPU.
+    // If PBO and if possible, copy directly on the GPU.  The copy is left in the PBO, and is only
+    // waited on when the application maps the buffer.
+    RendererScoped<ImageHelper> transformedImage(renderer);
     if (packPixelsParams.packBuffer)
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "ImageHelper::readPixelsImpl - PBO");
 
-        const ptrdiff_t pixelsOffset = reinterpret_cast<ptrdiff_t>(pixels);
-        if (canCopyWithTransformForReadPixels(packPixelsParams, srcExtent, readFormat,
-                                              pixelsOffset))
+        const ptrdiff_t pixelsOffset      = reinterpret_cast<ptrdiff_t>(pixels);
+        const PackPixelsParams *gpuParams = &packPixelsParams;
+        PackPixelsParams untransformedParams;
+
+        // If the rotation or y-flip can't be done by the copies below (such as when reading back
+        // a pre-rotated surface), apply it with a draw into a staging image first, instead of
+        // falling back to packing the pixels on the CPU.
+        if (!canCopyWithTransformForReadPixels(packPixelsParams, srcExtent, readFormat,
+                                               pixelsOffset) &&
+            !canCopyWithComputeForReadPixels(packPixelsParams, srcExtent, readFormat,
+                                             pixelsOffset) &&
+            canTransformWithDrawForReadPixels(renderer, src, packPixelsParams, srcExtent,
+                                              readFormat, copyAspectFlags, pixelsOffset))
         {
-            BufferHelper &packBuffer      = GetImpl(packPixelsParams.packBuffer)->getBuffer();
+            ANGLE_TRY(transformWithDrawForReadPixels(contextVk, src, packPixelsParams, srcOffset,
+                                                     srcExtent, srcSubresource,
+                                                     &transformedImage.get()));
+
+            untransformedParams = GetUntransformedReadPixelsParams(packPixelsParams);
+            gpuParams           = &untransformedParams;
+            srcExtent           = GetUntransformedReadPixelsExtent(packPixelsParams, srcExtent);
+
+            // Make the transformed image the target of buffer copy.
+            src                           = &transformedImage.get();
+            srcOffset                     = {0, 0, 0};
+            srcSubresource.baseArrayLayer = 0;
+            srcSubresource.layerCount     = 1;
+            srcSubresource.mipLevel       = 0;
+            layoutChangeAspectFlags       = src->getAspectFlags();
+        }
+
+        if (canCopyWithTransformForReadPixels(*gpuParams, srcExtent, readFormat, pixelsOffset))
+        {
+            BufferHelper &packBuffer      = GetImpl(gpuParams->packBuffer)->getBuffer();
             VkDeviceSize packBufferOffset = packBuffer.getOffset();
 
             CommandBufferAccess copyAccess;
@@ -11898,12 +12294,12 @@ angle::Result ImageHelper::readPixelsImpl(ContextVk *contextVk,
             OutsideRenderPassCommandBuffer *copyCommandBuffer;
             ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(copyAccess, &copyCommandBuffer));
 
-            ASSERT(packPixelsParams.outputPitch % readFormat->pixelBytes == 0);
+            ASSERT(gpuParams->outputPitch % readFormat->pixelBytes == 0);
 
             VkBufferImageCopy region = {};
             region.bufferImageHeight = srcExtent.height;
-            region.bufferOffset      = packBufferOffset + packPixelsParams.offset + pixelsOffset;
-            region.bufferRowLength   = packPixelsParams.outputPitch / readFormat->pixelBytes;
+            region.bufferOffset      = packBufferOffset + gpuParams->offset + pixelsOffset;
+            region.bufferRowLength   = gpuParams->outputPitch / readFormat->pixelBytes;
             region.imageExtent       = srcExtent;
             region.imageOffset       = srcOffset;
             region.imageSubresource  = srcSubresource;
@@ -11912,12 +12308,15 @@ angle::Result ImageHelper::readPixelsImpl(ContextVk *contextVk,
                                                  packBuffer.getBuffer().getHandle(), 1, &region);
             return angle::Result::Continue;
         }
-        if (canCopyWithComputeForReadPixels(packPixelsParams, srcExtent, readFormat, pixelsOffset))
+        if (canCopyWithComputeForReadPixels(*gpuParams, srcExtent, readFormat, pixelsOffset))
         {
-            ANGLE_TRY(readPixelsWithCompute(contextVk, src, packPixelsParams, srcOffset, srcExtent,
+            ANGLE_TRY(readPixelsWithCompute(contextVk, src, *gpuParams, srcOffset, srcExtent,
                                             pixelsOffset, srcSubresource));
             return angle::Result::Continue;
         }
+
+        // The transformation is only done if one of the copies above can take the result.
+        ASSERT(gpuParams == &packPixelsParams);
     }
 
     ANGLE_TRACE_EVENT0("gpu.angle", "ImageHelper::readPixelsImpl - CPU Readback");
@@ -13539,6 +13938,27 @@ angle::Result MetaDescriptorPool::bindCachedDescriptorPool(
     return angle::Result::Continue;
 }
 
+void MetaDescriptorPool::trimStaleDescriptorSets(Renderer *renderer, uint32_t currentFrame)
+{
+    for (auto iter = mPayload.begin(); iter != mPayload.end();)
+    {
+        DynamicDescriptorPoolPointer &pool = iter->second;
+        pool->trimStaleDescriptorSets(renderer, currentFrame);
+
+        // Once no program uses this layout, the pool is only kept for its cached descriptorSets in
+        // case a program with an identical layout is linked again.  When all of them are evicted,
+        // there is no reason to hold on to it.
+        if (pool.unique() && pool->isEmpty())
+        {
+            iter = mPayload.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
 static_assert(static_cast<uint32_t>(PresentMode::ImmediateKHR) == VK_PRESENT_MODE_IMMEDIATE_KHR,
               "PresentMode must be updated");
 static_assert(static_cast<uint32_t>(PresentMode::MailboxKHR) == VK_PRESENT_MODE_MAILBOX_KHR,
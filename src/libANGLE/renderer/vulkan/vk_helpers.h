@@ -485,6 +485,15 @@ class DynamicDescriptorPool final : angle::NonCopyable
     void destroyUnusedPool(Renderer *renderer, const DescriptorPoolWeakPointer &pool);
     void checkAndDestroyUnusedPool(Renderer *renderer);
 
+    // Evict cached descriptorSets that have not been used in the past few frames and release the
+    // pools that become empty as a result.  Unlike the eviction done when allocation fails, this
+    // runs periodically so that descriptorSets of programs that are no longer drawn with do not
+    // pin their pools indefinitely.
+    void trimStaleDescriptorSets(Renderer *renderer, uint32_t currentFrame);
+    // True if no descriptorSet is cached or allocated from this pool, i.e. it can be destroyed
+    // without waiting for the GPU.
+    bool isEmpty() const;
+
     // For ASSERT use only. Return true if mDescriptorSetCache contains DescriptorSet for desc.
     bool hasCachedDescriptorSet(const DescriptorSetDesc &desc) const;
     // For testing only!
@@ -557,6 +566,10 @@ class MetaDescriptorPool final : angle::NonCopyable
         }
     }
 
+    // Trim stale descriptorSets of every pool, and drop the pools that are no longer referenced
+    // by any program and have nothing left cached.
+    void trimStaleDescriptorSets(Renderer *renderer, uint32_t currentFrame);
+
     void resetDescriptorCacheStats()
     {
         for (auto &iter : mPayload)
@@ -1275,6 +1288,10 @@ class BufferPool : angle::NonCopyable
     size_t getBufferCount() const { return mBufferBlocks.size() + mEmptyBufferBlocks.size(); }
     VkDeviceSize getMemorySize() const { return mTotalMemorySize; }
 
+    // max size to go down the suballocation code path. Any allocation greater or equal this size
+    // will call into vulkan directly to allocate a dedicated VkDeviceMemory.
+    static constexpr size_t kMaxBufferSizeForSuballocation = 4 * 1024 * 1024;
+
   private:
     VkResult allocateNewBuffer(ErrorContext *context, VkDeviceSize sizeInBytes);
     VkDeviceSize getTotalEmptyMemorySize() const;
@@ -1290,9 +1307,6 @@ class BufferPool : angle::NonCopyable
     // Tracks the number of new buffers needed for suballocation since last pruneEmptyBuffers call.
     // We will use this heuristic information to decide how many empty buffers to keep around.
     size_t mNumberOfNewBuffersNeededSinceLastPrune;
-    // max size to go down the suballocation code path. Any allocation greater or equal this size
-    // will call into vulkan directly to allocate a dedicated VkDeviceMemory.
-    static constexpr size_t kMaxBufferSizeForSuballocation = 4 * 1024 * 1024;
 };
 using BufferPoolPointerArray = std::array<std::unique_ptr<BufferPool>, VK_MAX_MEMORY_TYPES>;
 
@@ -2751,6 +2765,9 @@ class ImageHelper final : public Resource, public angle::Subject
                                         uint32_t layerCount) const;
     bool hasStagedUpdatesInAllocatedLevels() const;
     bool hasBufferSourcedStagedUpdatesInAllLevels() const;
+    // Whether the staged buffer updates hold more memory than should be accumulated before they
+    // are flushed to the image.
+    bool isStagedBufferUpdateSizeOverBudget() const;
 
     bool removeStagedClearUpdatesAndReturnColor(gl::LevelIndex levelGL,
                                                 const VkClearColorValue **color);
@@ -2916,6 +2933,16 @@ class ImageHelper final : public Resource, public angle::Subject
                                         ptrdiff_t pixelsOffset,
                                         const VkImageSubresourceLayers &srcSubresource);
 
+    // Applies the rotation and y-flip of a readback with a draw into |dst|, a staging image
+    // created by this function, so that it can be copied to a PBO without transformation.
+    angle::Result transformWithDrawForReadPixels(ContextVk *contextVk,
+                                                 ImageHelper *src,
+                                                 const PackPixelsParams &packPixelsParams,
+                                                 const VkOffset3D &srcOffset,
+                                                 const VkExtent3D &srcExtent,
+                                                 const VkImageSubresourceLayers &srcSubresource,
+                                                 ImageHelper *dst);
+
     angle::Result readPixels(ContextVk *contextVk,
                              const gl::Rectangle &area,
                              const PackPixelsParams &packPixelsParams,
@@ -3286,6 +3313,21 @@ class ImageHelper final : public Resource, public angle::Subject
                                         const gl::LevelIndex level,
                                         const PruneReason reason);
 
+    // Writes a small color update into the staging buffer of the last staged update of the same
+    // subresource if the two updates together cover a rectangle, growing that staging buffer if
+    // needed.  This avoids a staging allocation and a copy region per update when many small
+    // adjacent sub-rectangles are uploaded, such as glyphs into a font atlas.
+    angle::Result coalesceWithLastStagedBufferUpdate(ContextVk *contextVk,
+                                                     const gl::ImageIndex &index,
+                                                     const gl::Extents &glExtents,
+                                                     const gl::Offset &offset,
+                                                     const angle::Format &storageFormat,
+                                                     LoadImageFunction loadFunction,
+                                                     const uint8_t *source,
+                                                     GLuint inputRowPitch,
+                                                     GLuint inputDepthPitch,
+                                                     bool *coalescedOut);
+
     // Whether there are any updates in [start, end).
     bool hasStagedUpdatesInLevels(gl::LevelIndex levelStart, gl::LevelIndex levelEnd) const;
 
@@ -3363,6 +3405,13 @@ class ImageHelper final : public Resource, public angle::Subject
                                          const VkExtent3D &srcExtent,
                                          const angle::Format *readFormat,
                                          ptrdiff_t pixelsOffset);
+    bool canTransformWithDrawForReadPixels(Renderer *renderer,
+                                           const ImageHelper *src,
+                                           const PackPixelsParams &packPixelsParams,
+                                           const VkExtent3D &srcExtent,
+                                           const angle::Format *readFormat,
+                                           VkImageAspectFlagBits copyAspectFlags,
+                                           ptrdiff_t pixelsOffset);
 
     // Returns true if source data and actual image format matches except color space differences.
     bool isDataFormatMatchForCopy(angle::FormatID srcDataFormatID) const
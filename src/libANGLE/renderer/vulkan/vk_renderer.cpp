@@ -14,8 +14,10 @@
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
 #include <EGL/eglext.h>
+#include <cstdio>
 #include <fstream>
 
+#include "common/angle_version_info.h"
 #include "common/debug.h"
 #include "common/platform.h"
 #include "common/system_utils.h"
@@ -1476,6 +1478,25 @@ class CompressAndStorePipelineCacheTask : public angle::Closure
     size_t mMaxTotalSize;
 };
 
+// Warms up the pipeline cache with the pipelines of commonly used internal functions.  This is a
+// best-effort optimization, so errors are only logged.
+class WarmUpInternalPipelinesTask : public ErrorContext, public angle::Closure
+{
+  public:
+    WarmUpInternalPipelinesTask(Renderer *renderer) : ErrorContext(renderer) {}
+
+    void operator()() override { (void)UtilsVk::WarmUpPipelines(this); }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
+    {
+        WARN() << "Internal pipeline warm up failed: " << VulkanResultString(result) << ", in "
+               << file << ", " << function << ":" << line << ".";
+    }
+};
+
 angle::Result GetAndDecompressPipelineCacheVk(vk::ErrorContext *context,
                                               vk::GlobalOps *globalOps,
                                               angle::MemoryBuffer *uncompressedData,
@@ -1757,6 +1778,122 @@ void DumpPipelineCacheGraph(Renderer *renderer, const std::ostringstream &graph)
     out.close();
 }
 
+// The device capability snapshot file starts with this header, followed by the
+// VkFormatProperties of every angle::FormatID and then by the VkExtensionProperties of the device
+// extensions provided by the implementation and implicit layers.  Format entries that were never
+// queried are left as kInvalidFormatFeatureFlags.  The version must be bumped whenever the layout
+// changes.
+constexpr uint32_t kDeviceCapabilitySnapshotMagic   = 0x414E4743;  // "ANGC"
+constexpr uint32_t kDeviceCapabilitySnapshotVersion = 2;
+
+struct DeviceCapabilitySnapshotHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t formatCount;
+    uint32_t extensionCount;
+    angle::BlobCacheKey key;
+};
+
+using DeviceCapabilitySnapshotFormats = std::array<VkFormatProperties, angle::kNumANGLEFormats>;
+
+// The snapshot is loaded before the features are decided, so it leaves out the formats whose
+// properties depend on them.  Those are queried from the driver as usual:
+// - External formats depend on the buffers imported by this process.
+// - forceD16TexFilter adds linear filtering to D16_UNORM.
+// - supportsTextureCompressionAstcHdr maps the ASTC UNORM formats to their SFLOAT counterparts.
+bool IsFormatInDeviceCapabilitySnapshot(const Renderer *renderer, angle::FormatID formatID)
+{
+    if (IsYUVExternalFormat(formatID) || formatID == angle::FormatID::D16_UNORM)
+    {
+        return false;
+    }
+
+    const VkFormat vkFormat = GetVkFormatFromFormatID(renderer, formatID);
+    const bool isASTCLDR =
+        vkFormat >= VK_FORMAT_ASTC_4x4_UNORM_BLOCK && vkFormat <= VK_FORMAT_ASTC_12x12_SRGB_BLOCK;
+    const bool isASTCHDR = vkFormat >= VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK &&
+                           vkFormat <= VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK;
+    return !isASTCLDR && !isASTCHDR;
+}
+
+// Enumerates the device extensions that are provided by the vulkan implementation and implicit
+// layers.
+VkResult EnumerateImplementationDeviceExtensions(VkPhysicalDevice physicalDevice,
+                                                 std::vector<VkExtensionProperties> *propsOut)
+{
+    uint32_t deviceExtensionCount = 0;
+    VkResult result = vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr,
+                                                           &deviceExtensionCount, nullptr);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    // Work-around a race condition in the Android platform during Android start-up, that can cause
+    // the second call to vkEnumerateDeviceExtensionProperties to have an additional extension.  In
+    // that case, the second call will return VK_INCOMPLETE.  To work-around that, add 1 to
+    // deviceExtensionCount and ask for one more extension property than the first call said there
+    // were.  See: http://anglebug.com/42265209 and internal-to-Google bug: b/206733351.
+    deviceExtensionCount++;
+    propsOut->resize(deviceExtensionCount);
+    result = vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &deviceExtensionCount,
+                                                  propsOut->data());
+    // In case fewer items were returned than requested, resize deviceExtensionProps to the number
+    // of extensions returned (i.e. deviceExtensionCount).  See: b/208937840
+    propsOut->resize(deviceExtensionCount);
+
+    return result;
+}
+
+void ComputeDeviceCapabilitySnapshotKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                        const VkPhysicalDeviceIDProperties &idProperties,
+                                        angle::BlobCacheKey *hashOut)
+{
+    std::ostringstream hashStream("ANGLE Device Capability Snapshot: ", std::ios_base::ate);
+    // The snapshot is only valid for the exact same device and driver.
+    for (const uint8_t c : idProperties.deviceUUID)
+    {
+        hashStream << std::hex << std::setw(2) << std::setfill('0') << static_cast<uint32_t>(c);
+    }
+    for (const uint8_t c : idProperties.driverUUID)
+    {
+        hashStream << std::hex << std::setw(2) << std::setfill('0') << static_cast<uint32_t>(c);
+    }
+    hashStream << std::hex << physicalDeviceProperties.vendorID;
+    hashStream << std::hex << physicalDeviceProperties.deviceID;
+    hashStream << std::hex << physicalDeviceProperties.driverVersion;
+
+    // The set of formats and their mapping to VkFormat may change between ANGLE versions.
+    hashStream << angle::GetANGLECommitHash();
+
+    const std::string &hashString = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.c_str()),
+                               hashString.length(), hashOut->data());
+}
+
+std::string GetDeviceCapabilitySnapshotPath(const angle::BlobCacheKey &key)
+{
+    // The snapshot is trusted once its key matches, so it's only kept in a directory the user
+    // chose.  A shared location such as the temp directory would let other users plant one.
+    const std::string directory = angle::GetEnvironmentVarOrAndroidProperty(
+        "ANGLE_DEVICE_CAPABILITY_SNAPSHOT_DIR", "angle.device_capability_snapshot_dir");
+    if (directory.empty())
+    {
+        return std::string();
+    }
+
+    // Name the file after the key, so that different devices and drivers don't evict each other.
+    std::ostringstream filename("angle_vk_device_", std::ios_base::ate);
+    for (const uint8_t c : key)
+    {
+        filename << std::hex << std::setw(2) << std::setfill('0') << static_cast<uint32_t>(c);
+    }
+    filename << ".bin";
+
+    return angle::ConcatenatePath(directory, filename.str());
+}
+
 bool CanSupportMSRTSSForRGBA8(Renderer *renderer)
 {
     // The support is checked for a basic 2D texture.
@@ -2027,6 +2164,12 @@ bool Renderer::hasSharedGarbage()
 
 void Renderer::onDestroy(vk::ErrorContext *context)
 {
+    if (mInternalPipelinesWarmUpEvent)
+    {
+        mInternalPipelinesWarmUpEvent->wait();
+        mInternalPipelinesWarmUpEvent.reset();
+    }
+
     if (isDeviceLost())
     {
         handleDeviceLost();
@@ -2594,6 +2737,13 @@ angle::Result Renderer::initialize(vk::ErrorContext *context,
     // Determine the threshold for pending garbage sizes.
     calculatePendingGarbageSizeLimit();
 
+    // The feature overrides are applied before the device is set up, so that the device
+    // capability snapshot can be loaded first.  The device extensions and the format properties
+    // that the features are decided on are then taken from the snapshot as well.
+    ApplyFeatureOverrides(&mFeatures, featureOverrides);
+    mDeviceCapabilitySnapshotLoaded =
+        mFeatures.useDeviceCapabilitySnapshot.enabled && loadDeviceCapabilitySnapshot();
+
     ANGLE_TRY(
         setupDevice(context, featureOverrides, wsiLayer, useVulkanSwapchain, nativeWindowSystem));
 
@@ -2604,9 +2754,15 @@ angle::Result Renderer::initialize(vk::ErrorContext *context,
     // multiple queue families, and using the first queue family is fine with it.
     ANGLE_TRY(createDeviceAndQueue(context, firstQueueFamily));
 
-    // Initialize the format table.
+    // Initialize the format table.  With a device capability snapshot, the format properties
+    // saved by an earlier process are used instead of querying the driver for every format.
     mFormatTable.initialize(this, &mNativeTextureCaps);
 
+    if (mFeatures.useDeviceCapabilitySnapshot.enabled && !mDeviceCapabilitySnapshotLoaded)
+    {
+        saveDeviceCapabilitySnapshot();
+    }
+
     // Null terminate the extension list returned for EGL_VULKAN_INSTANCE_EXTENSIONS_ANGLE.
     mEnabledInstanceExtensions.push_back(nullptr);
 
@@ -2630,6 +2786,163 @@ angle::Result Renderer::initialize(vk::ErrorContext *context,
     return angle::Result::Continue;
 }
 
+bool Renderer::loadDeviceCapabilitySnapshot()
+{
+    angle::BlobCacheKey key;
+    ComputeDeviceCapabilitySnapshotKey(mPhysicalDeviceProperties, mPhysicalDeviceIDProperties,
+                                       &key);
+    const std::string path = GetDeviceCapabilitySnapshotPath(key);
+    if (path.empty())
+    {
+        return false;
+    }
+
+    std::ifstream in = std::ifstream(path, std::ifstream::binary);
+    if (!in.is_open())
+    {
+        // No snapshot yet; one is written after the format table is initialized.
+        return false;
+    }
+
+    // The extension count is bounded so that a corrupted header cannot cause a huge allocation.
+    constexpr uint32_t kMaxDeviceExtensionCount = 4096;
+
+    DeviceCapabilitySnapshotHeader header = {};
+    DeviceCapabilitySnapshotFormats formatProperties;
+    std::vector<VkExtensionProperties> extensionProperties;
+    in.read(reinterpret_cast<char *>(&header), sizeof(header));
+    in.read(reinterpret_cast<char *>(formatProperties.data()), sizeof(formatProperties));
+    if (in && header.extensionCount <= kMaxDeviceExtensionCount)
+    {
+        extensionProperties.resize(header.extensionCount);
+        in.read(reinterpret_cast<char *>(extensionProperties.data()),
+                sizeof(VkExtensionProperties) * header.extensionCount);
+    }
+
+    if (!in || header.magic != kDeviceCapabilitySnapshotMagic ||
+        header.version != kDeviceCapabilitySnapshotVersion ||
+        header.formatCount != angle::kNumANGLEFormats ||
+        header.extensionCount > kMaxDeviceExtensionCount || header.key != key)
+    {
+        WARN() << "Ignoring invalid device capability snapshot \"" << path << "\"";
+        return false;
+    }
+
+    if (mFeatures.verifyDeviceCapabilitySnapshot.enabled)
+    {
+        for (size_t formatIndex = 0; formatIndex < angle::kNumANGLEFormats; ++formatIndex)
+        {
+            const auto formatID                = static_cast<angle::FormatID>(formatIndex);
+            const VkFormatProperties &snapshot = formatProperties[formatIndex];
+            if (snapshot.bufferFeatures == kInvalidFormatFeatureFlags ||
+                !IsFormatInDeviceCapabilitySnapshot(this, formatID))
+            {
+                continue;
+            }
+
+            const VkFormat vkFormat = vk::GetVkFormatFromFormatID(this, formatID);
+            VkFormatProperties live = {};
+            vkGetPhysicalDeviceFormatProperties(mPhysicalDevice, vkFormat, &live);
+
+            if (snapshot.linearTilingFeatures != live.linearTilingFeatures ||
+                snapshot.optimalTilingFeatures != live.optimalTilingFeatures ||
+                snapshot.bufferFeatures != live.bufferFeatures)
+            {
+                WARN() << "Device capability snapshot \"" << path
+                       << "\" does not match the driver for VkFormat " << vkFormat
+                       << "; discarding it";
+                return false;
+            }
+        }
+
+        std::vector<VkExtensionProperties> liveExtensionProperties;
+        const bool extensionsMatch =
+            EnumerateImplementationDeviceExtensions(mPhysicalDevice, &liveExtensionProperties) ==
+                VK_SUCCESS &&
+            liveExtensionProperties.size() == extensionProperties.size() &&
+            std::equal(extensionProperties.begin(), extensionProperties.end(),
+                       liveExtensionProperties.begin(),
+                       [](const VkExtensionProperties &a, const VkExtensionProperties &b) {
+                           return strcmp(a.extensionName, b.extensionName) == 0 &&
+                                  a.specVersion == b.specVersion;
+                       });
+        if (!extensionsMatch)
+        {
+            WARN() << "Device capability snapshot \"" << path
+                   << "\" does not match the device extensions of the driver; discarding it";
+            return false;
+        }
+    }
+
+    for (size_t formatIndex = 0; formatIndex < angle::kNumANGLEFormats; ++formatIndex)
+    {
+        const auto formatID = static_cast<angle::FormatID>(formatIndex);
+        if (IsFormatInDeviceCapabilitySnapshot(this, formatID))
+        {
+            mFormatProperties[formatID] = formatProperties[formatIndex];
+        }
+    }
+    mDeviceCapabilitySnapshotExtensions = std::move(extensionProperties);
+
+    return true;
+}
+
+void Renderer::saveDeviceCapabilitySnapshot() const
+{
+    DeviceCapabilitySnapshotHeader header = {};
+    header.magic                          = kDeviceCapabilitySnapshotMagic;
+    header.version                        = kDeviceCapabilitySnapshotVersion;
+    header.formatCount                    = angle::kNumANGLEFormats;
+    header.extensionCount = static_cast<uint32_t>(mDeviceCapabilitySnapshotExtensions.size());
+    ComputeDeviceCapabilitySnapshotKey(mPhysicalDeviceProperties, mPhysicalDeviceIDProperties,
+                                       &header.key);
+    const std::string path = GetDeviceCapabilitySnapshotPath(header.key);
+    if (path.empty())
+    {
+        return;
+    }
+
+    DeviceCapabilitySnapshotFormats formatProperties;
+    for (size_t formatIndex = 0; formatIndex < angle::kNumANGLEFormats; ++formatIndex)
+    {
+        const auto formatID           = static_cast<angle::FormatID>(formatIndex);
+        formatProperties[formatIndex] = mFormatProperties[formatID];
+
+        if (!IsFormatInDeviceCapabilitySnapshot(this, formatID))
+        {
+            formatProperties[formatIndex] = {0, 0, kInvalidFormatFeatureFlags};
+        }
+    }
+
+    // Write to a temporary file that is renamed into place, so processes starting concurrently
+    // never see a partially written snapshot.
+    const std::string directory = path.substr(0, path.find_last_of("/\\"));
+    Optional<std::string> tempPath = angle::CreateTemporaryFileInDirectory(directory);
+    if (!tempPath.valid())
+    {
+        WARN() << "Failed to create a device capability snapshot in \"" << directory << "\"";
+        return;
+    }
+
+    std::ofstream out = std::ofstream(tempPath.value(), std::ofstream::binary);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(formatProperties.data()), sizeof(formatProperties));
+    out.write(reinterpret_cast<const char *>(mDeviceCapabilitySnapshotExtensions.data()),
+              sizeof(VkExtensionProperties) * mDeviceCapabilitySnapshotExtensions.size());
+    out.close();
+
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    // rename() does not replace an existing file on Windows.
+    std::remove(path.c_str());
+#endif
+
+    if (!out || std::rename(tempPath.value().c_str(), path.c_str()) != 0)
+    {
+        WARN() << "Failed to write device capability snapshot \"" << path << "\"";
+        std::remove(tempPath.value().c_str());
+    }
+}
+
 angle::Result Renderer::initializeMemoryAllocator(vk::ErrorContext *context)
 {
     // This number matches Chromium and was picked by looking at memory usage of
@@ -4019,25 +4332,22 @@ angle::Result Renderer::enableDeviceExtensions(vk::ErrorContext *context,
                                                UseVulkanSwapchain useVulkanSwapchain,
                                                angle::NativeWindowSystem nativeWindowSystem)
 {
-    // Enumerate device extensions that are provided by the vulkan
-    // implementation and implicit layers.
-    uint32_t deviceExtensionCount = 0;
-    ANGLE_VK_TRY(context, vkEnumerateDeviceExtensionProperties(mPhysicalDevice, nullptr,
-                                                               &deviceExtensionCount, nullptr));
-
-    // Work-around a race condition in the Android platform during Android start-up, that can cause
-    // the second call to vkEnumerateDeviceExtensionProperties to have an additional extension.  In
-    // that case, the second call will return VK_INCOMPLETE.  To work-around that, add 1 to
-    // deviceExtensionCount and ask for one more extension property than the first call said there
-    // were.  See: http://anglebug.com/42265209 and internal-to-Google bug: b/206733351.
-    deviceExtensionCount++;
-    std::vector<VkExtensionProperties> deviceExtensionProps(deviceExtensionCount);
-    ANGLE_VK_TRY(context,
-                 vkEnumerateDeviceExtensionProperties(
-                     mPhysicalDevice, nullptr, &deviceExtensionCount, deviceExtensionProps.data()));
-    // In case fewer items were returned than requested, resize deviceExtensionProps to the number
-    // of extensions returned (i.e. deviceExtensionCount).  See: b/208937840
-    deviceExtensionProps.resize(deviceExtensionCount);
+    // Enumerate device extensions that are provided by the vulkan implementation and implicit
+    // layers, unless they were loaded from the device capability snapshot.
+    std::vector<VkExtensionProperties> deviceExtensionProps;
+    if (mDeviceCapabilitySnapshotLoaded)
+    {
+        deviceExtensionProps = mDeviceCapabilitySnapshotExtensions;
+    }
+    else
+    {
+        ANGLE_VK_TRY(context, EnumerateImplementationDeviceExtensions(mPhysicalDevice,
+                                                                      &deviceExtensionProps));
+        if (mFeatures.useDeviceCapabilitySnapshot.enabled)
+        {
+            mDeviceCapabilitySnapshotExtensions = deviceExtensionProps;
+        }
+    }
 
     // Enumerate device extensions that are provided by explicit layers.
     for (const char *layerName : mEnabledDeviceLayerNames)
@@ -4886,8 +5196,7 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                             UseVulkanSwapchain useVulkanSwapchain,
                             angle::NativeWindowSystem nativeWindowSystem)
 {
-    ApplyFeatureOverrides(&mFeatures, featureOverrides);
-
+    // The feature overrides were already applied by initialize().
     if (featureOverrides.allDisabled)
     {
         return;
@@ -5854,6 +6163,21 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
             (libraryBlobsAreReusedByMonolithicPipelines && !isQualcommProprietary &&
              !(IsLinux() && isIntel) && !(IsChromeOS() && isSwiftShader)));
 
+    // Warming up internal pipelines is opt-in; it trades worker thread time at context creation
+    // for a faster first use of index conversion and mipmap generation.
+    ANGLE_FEATURE_CONDITION(&mFeatures, warmUpInternalPipelines, false);
+
+    // Optimizing SPIR-V is opt-in; it trades link time on the worker threads for cheaper shaders
+    // on drivers that do little optimization of their own.  It is a no-op in builds without the
+    // spirv-tools optimizer.
+    ANGLE_FEATURE_CONDITION(&mFeatures, optimizeSpirv, false);
+
+    // The device capability snapshot is opt-in; it's meant for environments that start many
+    // short-lived processes on the same device.  Verifying the snapshot defeats its purpose and is
+    // only useful to validate it on new drivers.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useDeviceCapabilitySnapshot, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, verifyDeviceCapabilitySnapshot, false);
+
     // On SwiftShader, no data is retrieved from the pipeline cache, so there is no reason to
     // serialize it or put it in the blob cache.
     // For Windows NVIDIA Vulkan driver, Vulkan pipeline cache will only generate one
@@ -6314,6 +6638,17 @@ angle::Result Renderer::getPipelineCache(vk::ErrorContext *context,
     return angle::Result::Continue;
 }
 
+void Renderer::warmUpInternalPipelines()
+{
+    if (!mFeatures.warmUpInternalPipelines.enabled || mInternalPipelinesWarmUpEvent)
+    {
+        return;
+    }
+
+    mInternalPipelinesWarmUpEvent = mGlobalOps->postMultiThreadWorkerTask(
+        std::make_shared<WarmUpInternalPipelinesTask>(this));
+}
+
 angle::Result Renderer::mergeIntoPipelineCache(vk::ErrorContext *context,
                                                const vk::PipelineCache &pipelineCache)
 {
@@ -6381,6 +6716,9 @@ void Renderer::initializeFrontendFeatures(angle::FrontendFeatures *features) con
     // Always run the link's warm up job in a thread.  It's an optimization only, and does not block
     // the link resolution.
     ANGLE_FEATURE_CONDITION(features, alwaysRunLinkSubJobsThreaded, true);
+    // Linking the GLES1 emulation programs in the background is opt-in; until a program is ready,
+    // draws use a slower program that implements all fixed-function states dynamically.
+    ANGLE_FEATURE_CONDITION(features, specializeGles1ProgramsInBackground, false);
 }
 
 angle::Result Renderer::getLockedPipelineCacheDataIfNew(vk::ErrorContext *context,
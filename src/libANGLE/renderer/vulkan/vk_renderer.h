@@ -368,6 +368,10 @@ class Renderer : angle::NonCopyable
                                    vk::PipelineCacheAccess *pipelineCacheOut);
     angle::Result mergeIntoPipelineCache(vk::ErrorContext *context,
                                          const vk::PipelineCache &pipelineCache);
+    // If enabled, creates the pipelines of commonly used internal functions into the pipeline
+    // cache on a worker thread.  Done once, on first context creation, when the worker thread pool
+    // is available and the blob cache (which the pipeline cache is loaded from) is set up.
+    void warmUpInternalPipelines();
 
     void onNewValidationMessage(const std::string &message);
     std::string getAndClearLastValidationMessage(uint32_t *countSinceLastClear);
@@ -764,6 +768,11 @@ class Renderer : angle::NonCopyable
     // Initialize VMA allocator and buffer suballocator related data.
     angle::Result initializeMemoryAllocator(vk::ErrorContext *context);
 
+    // Load and save the device capability snapshot, a file holding mFormatProperties and the device
+    // extensions as queried by an earlier process on the same device, driver and ANGLE version.
+    bool loadDeviceCapabilitySnapshot();
+    void saveDeviceCapabilitySnapshot() const;
+
     // Query and cache supported fragment shading rates
     void queryAndCacheFragmentShadingRates();
     // Determine support for shading rate based rendering
@@ -926,6 +935,10 @@ class Renderer : angle::NonCopyable
     vk::FormatTable mFormatTable;
     // A cache of VkFormatProperties as queried from the device over time.
     mutable angle::FormatMap<VkFormatProperties> mFormatProperties;
+    // The device extensions provided by the implementation and implicit layers, as stored in the
+    // device capability snapshot.
+    std::vector<VkExtensionProperties> mDeviceCapabilitySnapshotExtensions;
+    bool mDeviceCapabilitySnapshotLoaded = false;
 
     vk::Allocator mAllocator;
 
@@ -1051,6 +1064,8 @@ class Renderer : angle::NonCopyable
 
     // Use thread pool to compress cache data.
     std::shared_ptr<angle::WaitableEvent> mCompressEvent;
+    // Internal pipeline warm up, see warmUpInternalPipelines().
+    std::shared_ptr<angle::WaitableEvent> mInternalPipelinesWarmUpEvent;
 
     VulkanLayerVector mEnabledDeviceLayerNames;
     vk::ExtensionNameList mEnabledInstanceExtensions;
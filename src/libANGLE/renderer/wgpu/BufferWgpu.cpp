@@ -29,8 +29,10 @@ wgpu::BufferUsage GetDefaultWGPUBufferUsageForBinding(gl::BufferBinding binding)
     {
         case gl::BufferBinding::Array:
         case gl::BufferBinding::ElementArray:
+            // Storage usage lets UtilsWgpu read index data in compute shaders.
             return wgpu::BufferUsage::Vertex | wgpu::BufferUsage::Index |
-                   wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+                   wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopySrc |
+                   wgpu::BufferUsage::CopyDst;
 
         case gl::BufferBinding::Uniform:
             return wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopySrc |
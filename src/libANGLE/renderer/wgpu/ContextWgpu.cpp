@@ -82,6 +82,7 @@ ContextWgpu::~ContextWgpu() {}
 
 void ContextWgpu::onDestroy(const gl::Context *context)
 {
+    mUtils.destroy();
     mImageLoadContext = {};
 }
 
@@ -15,6 +15,7 @@
 #include "image_util/loadimage.h"
 #include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/wgpu/DisplayWgpu.h"
+#include "libANGLE/renderer/wgpu/UtilsWgpu.h"
 #include "libANGLE/renderer/wgpu/wgpu_command_buffer.h"
 #include "libANGLE/renderer/wgpu/wgpu_format_utils.h"
 #include "libANGLE/renderer/wgpu/wgpu_helpers.h"
@@ -292,6 +293,8 @@ class ContextWgpu : public ContextImpl
     void ensureCommandEncoderCreated();
     wgpu::CommandEncoder &getCurrentCommandEncoder();
 
+    UtilsWgpu &getUtils() { return mUtils; }
+
   private:
     // Dirty bits.
     enum DirtyBitType : size_t
@@ -372,6 +375,8 @@ class ContextWgpu : public ContextImpl
     gl::AttributesMask mCurrentRenderPipelineAllAttributes;
 
     gl::DrawElementsType mCurrentIndexBufferType = gl::DrawElementsType::InvalidEnum;
+
+    UtilsWgpu mUtils;
 };
 
 }  // namespace rx
@@ -24,7 +24,9 @@
 namespace rx
 {
 
-DisplayWgpu::DisplayWgpu(const egl::DisplayState &state) : DisplayImpl(state) {}
+DisplayWgpu::DisplayWgpu(const egl::DisplayState &state)
+    : DisplayImpl(state), mScratchBuffer(1000u)
+{}
 
 DisplayWgpu::~DisplayWgpu() {}
 
@@ -296,6 +298,16 @@ egl::Error DisplayWgpu::createWgpuDevice()
     return egl::NoError();
 }
 
+void DisplayWgpu::putBlob(const angle::BlobCacheKey &key, const angle::MemoryBuffer &value)
+{
+    getBlobCache()->putApplication(nullptr, key, value);
+}
+
+bool DisplayWgpu::getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *valueOut)
+{
+    return getBlobCache()->get(nullptr, &mScratchBuffer, key, valueOut);
+}
+
 DisplayImpl *CreateWgpuDisplay(const egl::DisplayState &state)
 {
     return new DisplayWgpu(state);
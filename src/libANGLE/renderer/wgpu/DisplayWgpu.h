@@ -13,6 +13,7 @@
 #include <dawn/native/DawnNative.h>
 #include <dawn/webgpu_cpp.h>
 
+#include "common/MemoryBuffer.h"
 #include "libANGLE/renderer/DisplayImpl.h"
 #include "libANGLE/renderer/ShareGroupImpl.h"
 #include "libANGLE/renderer/wgpu/wgpu_format_utils.h"
@@ -112,6 +113,9 @@ class DisplayWgpu : public DisplayImpl
         return mFormatTable[internalFormat];
     }
 
+    void putBlob(const angle::BlobCacheKey &key, const angle::MemoryBuffer &value);
+    bool getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *valueOut);
+
   private:
     void generateExtensions(egl::DisplayExtensions *outExtensions) const override;
     void generateCaps(egl::Caps *outCaps) const override;
@@ -142,6 +146,8 @@ class DisplayWgpu : public DisplayImpl
     std::map<EGLNativeWindowType, wgpu::Surface> mSurfaceCache;
 
     webgpu::FormatTable mFormatTable;
+
+    angle::ScratchBuffer mScratchBuffer;
 };
 
 }  // namespace rx
@@ -8,15 +8,18 @@
 #include "libANGLE/renderer/wgpu/ProgramExecutableWgpu.h"
 
 #include <iterator>
+#include <sstream>
 
 #include "angle_gl.h"
 #include "anglebase/numerics/safe_conversions.h"
+#include "anglebase/sha1.h"
 #include "common/PackedGLEnums_autogen.h"
 #include "compiler/translator/wgsl/OutputUniformBlocks.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/renderer/renderer_utils.h"
 #include "libANGLE/renderer/wgpu/ContextWgpu.h"
+#include "libANGLE/renderer/wgpu/DisplayWgpu.h"
 #include "libANGLE/renderer/wgpu/wgpu_helpers.h"
 #include "libANGLE/renderer/wgpu/wgpu_pipeline_state.h"
 
@@ -34,7 +37,15 @@ ProgramExecutableWgpu::ProgramExecutableWgpu(const gl::ProgramExecutable *execut
 
 ProgramExecutableWgpu::~ProgramExecutableWgpu() = default;
 
-void ProgramExecutableWgpu::destroy(const gl::Context *context) {}
+void ProgramExecutableWgpu::destroy(const gl::Context *context)
+{
+    ContextWgpu *contextWgpu = webgpu::GetImpl(context);
+    if (mPipelineWarmUpListLoaded)
+    {
+        mPipelineCache.saveWarmUpList(contextWgpu->getDisplay(), mPipelineWarmUpListKey);
+    }
+    mPipelineCache.destroy(contextWgpu);
+}
 
 angle::Result ProgramExecutableWgpu::updateUniformsAndGetBindGroup(ContextWgpu *contextWgpu,
                                                                    wgpu::BindGroup *outBindGroup)
@@ -361,9 +372,41 @@ angle::Result ProgramExecutableWgpu::getRenderPipeline(ContextWgpu *context,
 
     genBindingLayoutIfNecessary(context);
 
+    if (!mPipelineWarmUpListLoaded)
+    {
+        // Start creating the pipelines that the previous program with the same shaders used while
+        // this first one is being created.
+        computePipelineWarmUpListKey();
+        mPipelineCache.loadWarmUpList(context, mPipelineWarmUpListKey, mPipelineLayout, shaders);
+        mPipelineWarmUpListLoaded = true;
+    }
+
     return mPipelineCache.getRenderPipeline(context, desc, mPipelineLayout, shaders, pipelineOut);
 }
 
+void ProgramExecutableWgpu::computePipelineWarmUpListKey()
+{
+    std::ostringstream hashStream("ANGLE WebGPU render pipelines: ", std::ios_base::ate);
+    for (gl::ShaderType shaderType : gl::AllShaderTypes())
+    {
+        if (!mShaderModules[shaderType].module)
+        {
+            continue;
+        }
+        hashStream << static_cast<uint32_t>(shaderType) << ":";
+        for (const uint8_t c : mShaderModules[shaderType].sourceHash)
+        {
+            hashStream << std::hex << static_cast<uint32_t>(c);
+        }
+    }
+    // The descs are stored as is, so their layout must match.
+    hashStream << std::hex << webgpu::kRenderPipelineDescSize;
+
+    const std::string &hashString = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.c_str()),
+                               hashString.length(), mPipelineWarmUpListKey.data());
+}
+
 void ProgramExecutableWgpu::genBindingLayoutIfNecessary(ContextWgpu *context)
 {
     if (mPipelineLayout)
@@ -21,6 +21,8 @@ namespace rx
 struct TranslatedWGPUShaderModule
 {
     wgpu::ShaderModule module;
+    // SHA1 hash of the WGSL source of |module|.
+    angle::BlobCacheKey sourceHash;
 };
 
 class ProgramExecutableWgpu : public ProgramExecutableImpl
@@ -103,6 +105,8 @@ class ProgramExecutableWgpu : public ProgramExecutableImpl
                                     const webgpu::RenderPipelineDesc &desc,
                                     wgpu::RenderPipeline *pipelineOut);
 
+    webgpu::PipelineCache &getPipelineCache() { return mPipelineCache; }
+
   private:
     angle::CheckedNumeric<size_t> getDefaultUniformAlignedSize(ContextWgpu *context,
                                                                gl::ShaderType shaderType) const;
@@ -113,9 +117,14 @@ class ProgramExecutableWgpu : public ProgramExecutableImpl
     // determined once the program is linked, and should be passed in pipeline creation. Fills in
     // `mPipelineLayout` and `mDefaultBindGroupLayout` if they haven't been already.
     void genBindingLayoutIfNecessary(ContextWgpu *context);
+    // The key of the pipeline warm up list in the blob cache is derived from the shader sources, so
+    // that any program with the same shaders reuses the list.
+    void computePipelineWarmUpListKey();
 
     gl::ShaderMap<TranslatedWGPUShaderModule> mShaderModules;
     webgpu::PipelineCache mPipelineCache;
+    angle::BlobCacheKey mPipelineWarmUpListKey;
+    bool mPipelineWarmUpListLoaded = false;
     // Holds the binding layout of resources (buffers, textures, samplers) required by the linked
     // shaders.
     wgpu::PipelineLayout mPipelineLayout;
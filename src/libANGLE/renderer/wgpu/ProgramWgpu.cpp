@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/wgpu/ProgramWgpu.h"
 
 #include "GLES2/gl2.h"
+#include "anglebase/sha1.h"
 #include "common/PackedEnums.h"
 #include "common/PackedGLEnums_autogen.h"
 #include "common/debug.h"
@@ -127,6 +128,9 @@ class CreateWGPUShaderModuleTask : public LinkSubTask
         shaderModuleDescriptor.nextInChain = &shaderModuleWGSLDescriptor;
 
         mShaderModule.module = mDevice.CreateShaderModule(&shaderModuleDescriptor);
+        angle::base::SHA1HashBytes(
+            reinterpret_cast<const unsigned char *>(finalShaderSource.c_str()),
+            finalShaderSource.length(), mShaderModule.sourceHash.data());
 
         wgpu::CompilationInfoCallback<CreateWGPUShaderModuleTask *> *getCompilationInfoCallback =
             [](wgpu::CompilationInfoRequestStatus status,
@@ -0,0 +1,261 @@
+//
+// Copyright 2025 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// UtilsWgpu.cpp:
+//    Implements the UtilsWgpu class.
+//
+
+#include "libANGLE/renderer/wgpu/UtilsWgpu.h"
+
+#include <array>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "libANGLE/renderer/wgpu/ContextWgpu.h"
+#include "libANGLE/renderer/wgpu/wgpu_utils.h"
+
+namespace rx
+{
+
+namespace
+{
+constexpr uint32_t kConvertIndexWorkgroupSize = 64;
+// Default value of wgpu::Limits::maxComputeWorkgroupsPerDimension.
+constexpr uint32_t kMaxWorkgroupsPerDimension = 65535;
+
+// Bits of ConvertIndexShaderParams::flags.
+constexpr uint32_t kConvertIndexSrcIndexSizeMask = 0x7;
+constexpr uint32_t kConvertIndexDst32Bit         = 0x8;
+constexpr uint32_t kConvertIndexLineLoop         = 0x10;
+constexpr uint32_t kConvertIndexPrimitiveRestart = 0x20;
+
+// Matches the Params struct of kConvertIndexShaderSource.
+struct ConvertIndexShaderParams
+{
+    uint32_t srcOffset;
+    uint32_t srcIndexCount;
+    uint32_t dstWordCount;
+    uint32_t flags;
+};
+
+// Every invocation outputs one 32-bit word of the destination buffer, which holds either two
+// 16-bit indices or one 32-bit index.  Indices are read from the packed 32-bit words of the source
+// buffer.  The output index past the last source index, only written for line loops, repeats the
+// first index.
+constexpr char kConvertIndexShaderSource[] = R"(
+struct Params
+{
+    srcOffset : u32,
+    srcIndexCount : u32,
+    dstWordCount : u32,
+    flags : u32,
+}
+
+@group(0) @binding(0) var<storage, read_write> dstIndices : array<u32>;
+@group(0) @binding(1) var<storage, read> srcIndices : array<u32>;
+@group(0) @binding(2) var<uniform> params : Params;
+
+const kSrcIndexSizeMask : u32 = 0x7u;
+const kDst32Bit : u32 = 0x8u;
+const kLineLoop : u32 = 0x10u;
+const kPrimitiveRestart : u32 = 0x20u;
+
+fn pullIndex(outputIndex : u32, dstRestartIndex : u32) -> u32
+{
+    var index = outputIndex;
+    if (index >= params.srcIndexCount)
+    {
+        index = 0u;
+    }
+
+    let srcIndexSize = params.flags & kSrcIndexSizeMask;
+    let srcRestartIndex = select(select(0xFFu, 0xFFFFu, srcIndexSize == 2u), 0xFFFFFFFFu,
+                                 srcIndexSize == 4u);
+    let byteOffset = params.srcOffset + index * srcIndexSize;
+    let value = (srcIndices[byteOffset >> 2u] >> ((byteOffset & 3u) * 8u)) & srcRestartIndex;
+
+    if ((params.flags & kPrimitiveRestart) != 0u && value == srcRestartIndex)
+    {
+        return dstRestartIndex;
+    }
+    return value;
+}
+
+@compute @workgroup_size(64)
+fn main(@builtin(global_invocation_id) globalId : vec3u,
+        @builtin(num_workgroups) numWorkgroups : vec3u)
+{
+    let word = globalId.x + globalId.y * numWorkgroups.x * 64u;
+    if (word >= params.dstWordCount)
+    {
+        return;
+    }
+
+    if ((params.flags & kDst32Bit) != 0u)
+    {
+        dstIndices[word] = pullIndex(word, 0xFFFFFFFFu);
+        return;
+    }
+
+    let outputIndexCount = params.srcIndexCount + select(0u, 1u, (params.flags & kLineLoop) != 0u);
+    let firstOutputIndex = word * 2u;
+    var value = pullIndex(firstOutputIndex, 0xFFFFu);
+    if (firstOutputIndex + 1u < outputIndexCount)
+    {
+        value |= pullIndex(firstOutputIndex + 1u, 0xFFFFu) << 16u;
+    }
+    dstIndices[word] = value;
+}
+)";
+}  // namespace
+
+UtilsWgpu::UtilsWgpu() = default;
+
+UtilsWgpu::~UtilsWgpu() = default;
+
+void UtilsWgpu::destroy()
+{
+    mConvertIndexBindGroupLayout = nullptr;
+    mConvertIndexPipeline        = nullptr;
+    mConvertIndexShaderModule    = nullptr;
+}
+
+angle::Result UtilsWgpu::ensureConvertIndexPipelineInitialized(ContextWgpu *contextWgpu)
+{
+    if (mConvertIndexPipeline)
+    {
+        return angle::Result::Continue;
+    }
+
+    wgpu::Device device = contextWgpu->getDevice();
+
+    wgpu::ShaderModuleWGSLDescriptor shaderModuleWGSLDescriptor;
+    shaderModuleWGSLDescriptor.code = kConvertIndexShaderSource;
+
+    wgpu::ShaderModuleDescriptor shaderModuleDescriptor;
+    shaderModuleDescriptor.nextInChain = &shaderModuleWGSLDescriptor;
+
+    ANGLE_WGPU_SCOPED_DEBUG_TRY(
+        contextWgpu,
+        mConvertIndexShaderModule = device.CreateShaderModule(&shaderModuleDescriptor));
+
+    wgpu::ComputePipelineDescriptor pipelineDesc;
+    pipelineDesc.compute.module     = mConvertIndexShaderModule;
+    pipelineDesc.compute.entryPoint = "main";
+
+    ANGLE_WGPU_SCOPED_DEBUG_TRY(
+        contextWgpu, mConvertIndexPipeline = device.CreateComputePipeline(&pipelineDesc));
+    mConvertIndexBindGroupLayout = mConvertIndexPipeline.GetBindGroupLayout(0);
+
+    return angle::Result::Continue;
+}
+
+angle::Result UtilsWgpu::convertIndexBuffer(ContextWgpu *contextWgpu,
+                                            webgpu::BufferHelper *dst,
+                                            webgpu::BufferHelper *src,
+                                            const ConvertIndexParameters &params)
+{
+    ASSERT(!contextWgpu->hasActiveRenderPass());
+    ASSERT(params.srcType != gl::DrawElementsType::InvalidEnum);
+    ASSERT(params.dstType == gl::DrawElementsType::UnsignedShort ||
+           params.dstType == gl::DrawElementsType::UnsignedInt);
+
+    const uint32_t srcIndexSize = gl::GetDrawElementsTypeSize(params.srcType);
+    const uint32_t dstIndexSize = gl::GetDrawElementsTypeSize(params.dstType);
+    ASSERT(dstIndexSize >= srcIndexSize);
+    ASSERT(params.srcOffset % srcIndexSize == 0);
+
+    const uint32_t outputIndexCount = params.indexCount + (params.isLineLoop ? 1 : 0);
+    const uint32_t dstWordCount =
+        rx::roundUpPow2(outputIndexCount * dstIndexSize, static_cast<uint32_t>(sizeof(uint32_t))) /
+        sizeof(uint32_t);
+    if (dstWordCount == 0)
+    {
+        return angle::Result::Continue;
+    }
+    ASSERT(dst->requestedSize() >= dstWordCount * sizeof(uint32_t));
+
+    ANGLE_TRY(ensureConvertIndexPipelineInitialized(contextWgpu));
+
+    wgpu::Device device = contextWgpu->getDevice();
+
+    // Only the range read by the draw is bound, as the whole element array buffer may exceed
+    // maxStorageBufferBindingSize.  The binding starts at the closest aligned offset before the
+    // first index, and the shader is given the remainder.
+    const uint32_t storageOffsetAlignment =
+        contextWgpu->getDisplay()->getLimitsWgpu().minStorageBufferOffsetAlignment;
+    const uint32_t srcBindingOffset = rx::roundDownPow2(params.srcOffset, storageOffsetAlignment);
+    const uint32_t srcOffsetInBinding = params.srcOffset - srcBindingOffset;
+    const uint64_t srcBindingSize =
+        rx::roundUpPow2(srcOffsetInBinding + params.indexCount * srcIndexSize,
+                        static_cast<uint32_t>(sizeof(uint32_t)));
+    ASSERT(srcBindingOffset + srcBindingSize <= src->actualSize());
+
+    ConvertIndexShaderParams shaderParams = {};
+    shaderParams.srcOffset                = srcOffsetInBinding;
+    shaderParams.srcIndexCount            = params.indexCount;
+    shaderParams.dstWordCount             = dstWordCount;
+    shaderParams.flags                    = srcIndexSize & kConvertIndexSrcIndexSizeMask;
+    if (dstIndexSize == 4)
+    {
+        shaderParams.flags |= kConvertIndexDst32Bit;
+    }
+    if (params.isLineLoop)
+    {
+        shaderParams.flags |= kConvertIndexLineLoop;
+    }
+    if (params.primitiveRestartEnabled)
+    {
+        shaderParams.flags |= kConvertIndexPrimitiveRestart;
+    }
+
+    // The parameters are recorded together with the dispatch, so every conversion needs its own
+    // uniform buffer.
+    webgpu::BufferHelper paramsBuffer;
+    ANGLE_TRY(paramsBuffer.initBuffer(device, sizeof(shaderParams), wgpu::BufferUsage::Uniform,
+                                      webgpu::MapAtCreation::Yes));
+    memcpy(paramsBuffer.getMapWritePointer(0, sizeof(shaderParams)), &shaderParams,
+           sizeof(shaderParams));
+    ANGLE_TRY(paramsBuffer.unmap());
+
+    std::array<wgpu::BindGroupEntry, 3> bindings;
+    bindings[0].binding = 0;
+    bindings[0].buffer  = dst->getBuffer();
+    bindings[0].offset  = 0;
+    bindings[0].size    = dstWordCount * sizeof(uint32_t);
+    bindings[1].binding = 1;
+    bindings[1].buffer  = src->getBuffer();
+    bindings[1].offset  = srcBindingOffset;
+    bindings[1].size    = srcBindingSize;
+    bindings[2].binding = 2;
+    bindings[2].buffer  = paramsBuffer.getBuffer();
+    bindings[2].offset  = 0;
+    bindings[2].size    = sizeof(shaderParams);
+
+    wgpu::BindGroupDescriptor bindGroupDesc;
+    bindGroupDesc.layout     = mConvertIndexBindGroupLayout;
+    bindGroupDesc.entryCount = bindings.size();
+    bindGroupDesc.entries    = bindings.data();
+    wgpu::BindGroup bindGroup;
+    ANGLE_WGPU_SCOPED_DEBUG_TRY(contextWgpu, bindGroup = device.CreateBindGroup(&bindGroupDesc));
+
+    // Large buffers are split over the second dimension to stay within the per-dimension limit.
+    const uint32_t workgroupCount  = UnsignedCeilDivide(dstWordCount, kConvertIndexWorkgroupSize);
+    const uint32_t workgroupCountX = std::min(workgroupCount, kMaxWorkgroupsPerDimension);
+    const uint32_t workgroupCountY = UnsignedCeilDivide(workgroupCount, workgroupCountX);
+
+    contextWgpu->ensureCommandEncoderCreated();
+    wgpu::CommandEncoder &commandEncoder = contextWgpu->getCurrentCommandEncoder();
+
+    wgpu::ComputePassEncoder computePass = commandEncoder.BeginComputePass();
+    computePass.SetPipeline(mConvertIndexPipeline);
+    computePass.SetBindGroup(0, bindGroup);
+    computePass.DispatchWorkgroups(workgroupCountX, workgroupCountY);
+    computePass.End();
+
+    return angle::Result::Continue;
+}
+
+}  // namespace rx
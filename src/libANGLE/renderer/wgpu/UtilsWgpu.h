@@ -0,0 +1,68 @@
+//
+// Copyright 2025 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// UtilsWgpu.h:
+//    Defines the UtilsWgpu class, a helper for internal dispatch utilities.
+//
+//    - Convert index buffer: Used by VertexArrayWgpu::syncClientArrays() to widen uint8 indices,
+//      translate primitive restart indices and close line loops on the GPU when the index data is
+//      already in an element array buffer.
+//
+
+#ifndef LIBANGLE_RENDERER_WGPU_UTILSWGPU_H_
+#define LIBANGLE_RENDERER_WGPU_UTILSWGPU_H_
+
+#include <dawn/webgpu_cpp.h>
+
+#include "libANGLE/angletypes.h"
+#include "libANGLE/renderer/wgpu/wgpu_helpers.h"
+
+namespace rx
+{
+class ContextWgpu;
+
+class UtilsWgpu : angle::NonCopyable
+{
+  public:
+    UtilsWgpu();
+    ~UtilsWgpu();
+
+    void destroy();
+
+    struct ConvertIndexParameters
+    {
+        gl::DrawElementsType srcType = gl::DrawElementsType::InvalidEnum;
+        gl::DrawElementsType dstType = gl::DrawElementsType::InvalidEnum;
+        // Offset in bytes of the first index in the source buffer.  Must be aligned to the size of
+        // srcType.
+        uint32_t srcOffset = 0;
+        // Number of indices read from the source buffer.
+        uint32_t indexCount = 0;
+        // Append the first index after the last one to draw the line loop as a line strip.
+        bool isLineLoop = false;
+        // Translate the primitive restart index of srcType to the one of dstType.
+        bool primitiveRestartEnabled = false;
+    };
+
+    // Writes the converted indices at the start of |dst|, which must be large enough to hold
+    // indexCount (plus one for line loops) indices of dstType, rounded up to four bytes.  |src|
+    // must have been created with storage usage.  The dispatch is recorded in the current command
+    // encoder, so no render pass may be open.
+    angle::Result convertIndexBuffer(ContextWgpu *contextWgpu,
+                                     webgpu::BufferHelper *dst,
+                                     webgpu::BufferHelper *src,
+                                     const ConvertIndexParameters &params);
+
+  private:
+    angle::Result ensureConvertIndexPipelineInitialized(ContextWgpu *contextWgpu);
+
+    wgpu::ShaderModule mConvertIndexShaderModule;
+    wgpu::ComputePipeline mConvertIndexPipeline;
+    wgpu::BindGroupLayout mConvertIndexBindGroupLayout;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_WGPU_UTILSWGPU_H_
@@ -70,6 +70,42 @@ void CopyIndexData(const uint8_t *sourceData, size_t count, uint8_t *destData)
 }
 using CopyIndexFunction = void (*)(const uint8_t *sourceData, size_t count, uint8_t *destData);
 
+// After widening, restart indices of the source type must be replaced with the restart index of the
+// destination type.
+template <typename SourceType, typename DestType>
+void TranslatePrimitiveRestartIndicesImpl(const uint8_t *sourceData,
+                                          size_t count,
+                                          uint8_t *destData)
+{
+    const SourceType *src = reinterpret_cast<const SourceType *>(sourceData);
+    DestType *dst         = reinterpret_cast<DestType *>(destData);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (src[i] == std::numeric_limits<SourceType>::max())
+        {
+            dst[i] = std::numeric_limits<DestType>::max();
+        }
+    }
+}
+
+void TranslatePrimitiveRestartIndices(gl::DrawElementsType sourceType,
+                                      gl::DrawElementsType destType,
+                                      const uint8_t *sourceData,
+                                      size_t count,
+                                      uint8_t *destData)
+{
+    ASSERT(sourceType == gl::DrawElementsType::UnsignedByte);
+    if (destType == gl::DrawElementsType::UnsignedShort)
+    {
+        TranslatePrimitiveRestartIndicesImpl<GLubyte, GLushort>(sourceData, count, destData);
+    }
+    else
+    {
+        ASSERT(destType == gl::DrawElementsType::UnsignedInt);
+        TranslatePrimitiveRestartIndicesImpl<GLubyte, GLuint>(sourceData, count, destData);
+    }
+}
+
 CopyIndexFunction GetCopyIndexFunction(gl::DrawElementsType sourceType,
                                        gl::DrawElementsType destType)
 {
@@ -294,6 +330,22 @@ angle::Result VertexArrayWgpu::syncClientArrays(
         *indexCountOut = adjustedCount;
     }
 
+    // When the index data is already in an element array buffer, uint8 widening, primitive restart
+    // translation and line loop closing are done with a compute shader instead of reading the
+    // indices back to the CPU.  Line loops with primitive restart change the index count, which
+    // must be known on the CPU for the draw call, so they still go through the staging buffer.
+    webgpu::BufferHelper *gpuIndexConversionSource = nullptr;
+    if (indexDataNeedsStreaming == IndexDataNeedsStreaming::Yes && elementArrayBuffer &&
+        sourceDrawElementsTypeOrInvalid != gl::DrawElementsType::InvalidEnum &&
+        !(primitiveRestartEnabled && mode == gl::PrimitiveMode::LineLoop))
+    {
+        webgpu::BufferHelper &sourceBuffer = GetImplAs<BufferWgpu>(elementArrayBuffer)->getBuffer();
+        if (sourceBuffer.getBuffer().GetUsage() & wgpu::BufferUsage::Storage)
+        {
+            gpuIndexConversionSource = &sourceBuffer;
+        }
+    }
+
     // If any attributes need to be streamed, we need to know the index range. We also need to know
     // the index range if there is a draw arrays call and we have to stream the index data for it.
     std::optional<gl::IndexRange> indexRange;
@@ -323,10 +375,9 @@ angle::Result VertexArrayWgpu::syncClientArrays(
             static_cast<size_t>(gl::GetDrawElementsTypeSize(destDrawElementsTypeOrInvalid));
         destIndexDataSize = destIndexUnitSize.value() * adjustedCount;
 
-        // Allocating staging buffer space for indices is only needed when there is no source index
-        // buffer or index data conversion is needed
-        if (primitiveRestartEnabled || !elementArrayBuffer ||
-            sourceDrawElementsTypeOrInvalid != destDrawElementsTypeOrInvalid)
+        // Allocating staging buffer space for indices is only needed when the indices are not
+        // converted on the GPU
+        if (gpuIndexConversionSource == nullptr)
         {
             stagingBufferSize +=
                 rx::roundUpPow2(destIndexDataSize.value(), webgpu::kBufferCopyToBufferAlignment);
@@ -386,6 +437,7 @@ angle::Result VertexArrayWgpu::syncClientArrays(
         uint64_t size;
     };
     std::vector<BufferCopy> stagingUploads;
+    std::optional<UtilsWgpu::ConvertIndexParameters> indexConversion;
 
     if (indexDataNeedsStreaming == IndexDataNeedsStreaming::Yes)
     {
@@ -397,9 +449,10 @@ angle::Result VertexArrayWgpu::syncClientArrays(
 
         size_t destIndexBufferSize =
             rx::roundUpPow2(destIndexDataSize.value(), webgpu::kBufferCopyToBufferAlignment);
-        ANGLE_TRY(ensureBufferCreated(context, mStreamingIndexBuffer, destIndexBufferSize, 0,
-                                      wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Index,
-                                      BufferType::IndexBuffer));
+        ANGLE_TRY(ensureBufferCreated(
+            context, mStreamingIndexBuffer, destIndexBufferSize, 0,
+            wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Index | wgpu::BufferUsage::Storage,
+            BufferType::IndexBuffer));
         // TODO(anglebug.com/401226623): Don't use the staging buffer when the adjustedCount for
         // primitive restarts is count + 1.
         if (primitiveRestartEnabled && mode == gl::PrimitiveMode::LineLoop)
@@ -415,33 +468,17 @@ angle::Result VertexArrayWgpu::syncClientArrays(
             stagingUploads.push_back({currentStagingDataPosition, &stagingBuffer,
                                       &mStreamingIndexBuffer, 0, destIndexBufferSize});
         }
-        else if (sourceDrawElementsTypeOrInvalid == destDrawElementsTypeOrInvalid &&
-                 elementArrayBuffer)
+        else if (gpuIndexConversionSource)
         {
-            // Use the element array buffer as the source for the new streaming index buffer. This
-            // condition is only hit when an indexed draw call has an element array buffer and is
-            // trying to draw line loops.
-
             // When using an element array buffer, 'indices' is an offset to the first element.
-            size_t sourceOffset                = reinterpret_cast<size_t>(indices);
-            BufferWgpu *elementArrayBufferWgpu = GetImplAs<BufferWgpu>(elementArrayBuffer);
-            webgpu::BufferHelper *sourceBuffer = &elementArrayBufferWgpu->getBuffer();
-
-            size_t copySize = rx::roundUpPow2(destIndexUnitSize.value() * count,
-                                              webgpu::kBufferCopyToBufferAlignment);
-            stagingUploads.push_back(
-                {sourceOffset, sourceBuffer, &mStreamingIndexBuffer, 0, copySize});
-
-            if (mode == gl::PrimitiveMode::LineLoop)
-            {
-                // Emulate line loops with an additional copy of the first index at the end of the
-                // buffer
-                size_t lastOffset = copySize;
-                stagingUploads.push_back({sourceOffset, sourceBuffer, &mStreamingIndexBuffer,
-                                          lastOffset,
-                                          rx::roundUpPow2(destIndexUnitSize.value(),
-                                                          webgpu::kBufferCopyToBufferAlignment)});
-            }
+            UtilsWgpu::ConvertIndexParameters params;
+            params.srcType    = sourceDrawElementsTypeOrInvalid;
+            params.dstType    = destDrawElementsTypeOrInvalid;
+            params.srcOffset  = gl::clampCast<uint32_t>(reinterpret_cast<size_t>(indices));
+            params.indexCount = static_cast<uint32_t>(count);
+            params.isLineLoop = mode == gl::PrimitiveMode::LineLoop;
+            params.primitiveRestartEnabled = primitiveRestartEnabled;
+            indexConversion                = params;
         }
         // Handle emulating line loop for draw arrays calls.
         else if (sourceDrawElementsTypeOrInvalid == gl::DrawElementsType::InvalidEnum)
@@ -488,11 +525,20 @@ angle::Result VertexArrayWgpu::syncClientArrays(
             ASSERT(stagingData != nullptr);
             indexCopyFunction(srcIndexData, count, stagingData + currentStagingDataPosition);
 
+            if (primitiveRestartEnabled &&
+                sourceDrawElementsTypeOrInvalid != destDrawElementsTypeOrInvalid)
+            {
+                TranslatePrimitiveRestartIndices(sourceDrawElementsTypeOrInvalid,
+                                                 destDrawElementsTypeOrInvalid, srcIndexData, count,
+                                                 stagingData + currentStagingDataPosition);
+            }
+
             if (mode == gl::PrimitiveMode::LineLoop)
             {
-                indexCopyFunction(
-                    srcIndexData, count,
-                    stagingData + currentStagingDataPosition + (destIndexUnitSize.value() * count));
+                // Close the line loop by repeating the first index.
+                uint8_t *lineLoopStagingData = stagingData + currentStagingDataPosition;
+                memcpy(lineLoopStagingData + (destIndexUnitSize.value() * count),
+                       lineLoopStagingData, destIndexUnitSize.value());
             }
 
             size_t copySize = destIndexBufferSize;
@@ -500,7 +546,6 @@ angle::Result VertexArrayWgpu::syncClientArrays(
                 {currentStagingDataPosition, &stagingBuffer, &mStreamingIndexBuffer, 0, copySize});
             currentStagingDataPosition += copySize;
         }
-        // TODO(anglebug.com/383356846): add support for primitive restarts
     }
 
     for (size_t attribIndex : clientAttributesToSync)
@@ -578,6 +623,17 @@ angle::Result VertexArrayWgpu::syncClientArrays(
                                           copy.dest->getBuffer(), copy.destOffset, copy.size);
     }
 
+    if (indexConversion.has_value())
+    {
+        if (gpuIndexConversionSource->getMappedState())
+        {
+            ANGLE_TRY(gpuIndexConversionSource->unmap());
+        }
+        ANGLE_TRY(contextWgpu->getUtils().convertIndexBuffer(contextWgpu, &mStreamingIndexBuffer,
+                                                             gpuIndexConversionSource,
+                                                             indexConversion.value()));
+    }
+
     return angle::Result::Continue;
 }
 
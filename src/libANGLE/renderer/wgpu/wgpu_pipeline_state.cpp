@@ -6,10 +6,15 @@
 
 #include "libANGLE/renderer/wgpu/wgpu_pipeline_state.h"
 
+#include <algorithm>
+
 #include "common/aligned_memory.h"
 #include "common/hash_utils.h"
+#include "common/BinaryStream.h"
+#include "common/MemoryBuffer.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/renderer/wgpu/ContextWgpu.h"
+#include "libANGLE/renderer/wgpu/DisplayWgpu.h"
 #include "libANGLE/renderer/wgpu/wgpu_utils.h"
 
 namespace rx
@@ -52,6 +57,19 @@ PackedVertexAttribute::PackedVertexAttribute()
     memset(this, 0, sizeof(PackedVertexAttribute));
 }
 
+// Holds the structs that a wgpu::RenderPipelineDescriptor points to, so that it can be filled in
+// once for both the synchronous and asynchronous pipeline creation.
+struct RenderPipelineDescriptorStorage
+{
+    wgpu::RenderPipelineDescriptor pipelineDesc;
+    gl::AttribArray<wgpu::VertexBufferLayout> vertexBuffers;
+    gl::AttribArray<wgpu::VertexAttribute> vertexAttribs;
+    wgpu::FragmentState fragmentState;
+    std::array<wgpu::ColorTargetState, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS> colorTargets;
+    std::array<wgpu::BlendState, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS> blendStates;
+    wgpu::DepthStencilState depthStencilState;
+};
+
 // GraphicsPipelineDesc implementation.
 RenderPipelineDesc::RenderPipelineDesc()
 {
@@ -305,13 +323,12 @@ size_t RenderPipelineDesc::hash() const
     return angle::ComputeGenericHash(this, sizeof(*this));
 }
 
-angle::Result RenderPipelineDesc::createPipeline(ContextWgpu *context,
-                                                 const wgpu::PipelineLayout &pipelineLayout,
-                                                 const gl::ShaderMap<wgpu::ShaderModule> &shaders,
-                                                 wgpu::RenderPipeline *pipelineOut) const
+void RenderPipelineDesc::fillPipelineDescriptor(const wgpu::PipelineLayout &pipelineLayout,
+                                                const gl::ShaderMap<wgpu::ShaderModule> &shaders,
+                                                RenderPipelineDescriptorStorage *storage) const
 {
-    wgpu::RenderPipelineDescriptor pipelineDesc;
-    pipelineDesc.layout = pipelineLayout;
+    wgpu::RenderPipelineDescriptor &pipelineDesc = storage->pipelineDesc;
+    pipelineDesc.layout                          = pipelineLayout;
 
     pipelineDesc.vertex.module        = shaders[gl::ShaderType::Vertex];
     pipelineDesc.vertex.entryPoint    = "wgslMain";
@@ -334,9 +351,9 @@ angle::Result RenderPipelineDesc::createPipeline(ContextWgpu *context,
     pipelineDesc.primitive.frontFace = UnpackFrontFace(mPrimitiveState.frontFace);
     pipelineDesc.primitive.cullMode  = static_cast<wgpu::CullMode>(mPrimitiveState.cullMode);
 
-    size_t attribCount = 0;
-    gl::AttribArray<wgpu::VertexBufferLayout> vertexBuffers;
-    gl::AttribArray<wgpu::VertexAttribute> vertexAttribs;
+    size_t attribCount                                       = 0;
+    gl::AttribArray<wgpu::VertexBufferLayout> &vertexBuffers = storage->vertexBuffers;
+    gl::AttribArray<wgpu::VertexAttribute> &vertexAttribs    = storage->vertexAttribs;
 
     for (PackedVertexAttribute packedAttrib : mVertexAttributes)
     {
@@ -362,9 +379,11 @@ angle::Result RenderPipelineDesc::createPipeline(ContextWgpu *context,
     pipelineDesc.vertex.bufferCount = attribCount;
     pipelineDesc.vertex.buffers     = vertexBuffers.data();
 
-    wgpu::FragmentState fragmentState;
-    std::array<wgpu::ColorTargetState, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS> colorTargets;
-    std::array<wgpu::BlendState, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS> blendStates;
+    wgpu::FragmentState &fragmentState = storage->fragmentState;
+    std::array<wgpu::ColorTargetState, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS> &colorTargets =
+        storage->colorTargets;
+    std::array<wgpu::BlendState, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS> &blendStates =
+        storage->blendStates;
     if (shaders[gl::ShaderType::Fragment])
     {
         fragmentState.module        = shaders[gl::ShaderType::Fragment];
@@ -414,7 +433,7 @@ angle::Result RenderPipelineDesc::createPipeline(ContextWgpu *context,
         pipelineDesc.fragment = &fragmentState;
     }
 
-    wgpu::DepthStencilState depthStencilState;
+    wgpu::DepthStencilState &depthStencilState = storage->depthStencilState;
     if (static_cast<wgpu::TextureFormat>(mDepthStencilState.format) !=
         wgpu::TextureFormat::Undefined)
     {
@@ -453,21 +472,89 @@ angle::Result RenderPipelineDesc::createPipeline(ContextWgpu *context,
 
         pipelineDesc.depthStencil = &depthStencilState;
     }
+}
+
+angle::Result RenderPipelineDesc::createPipeline(ContextWgpu *context,
+                                                 const wgpu::PipelineLayout &pipelineLayout,
+                                                 const gl::ShaderMap<wgpu::ShaderModule> &shaders,
+                                                 wgpu::RenderPipeline *pipelineOut) const
+{
+    RenderPipelineDescriptorStorage storage;
+    fillPipelineDescriptor(pipelineLayout, shaders, &storage);
 
     wgpu::Device device = context->getDevice();
-    ANGLE_WGPU_SCOPED_DEBUG_TRY(context, *pipelineOut = device.CreateRenderPipeline(&pipelineDesc));
+    ANGLE_WGPU_SCOPED_DEBUG_TRY(context,
+                                *pipelineOut = device.CreateRenderPipeline(&storage.pipelineDesc));
 
     return angle::Result::Continue;
 }
 
+wgpu::Future RenderPipelineDesc::createPipelineAsync(
+    ContextWgpu *context,
+    const wgpu::PipelineLayout &pipelineLayout,
+    const gl::ShaderMap<wgpu::ShaderModule> &shaders,
+    PendingRenderPipeline *userdata) const
+{
+    RenderPipelineDescriptorStorage storage;
+    fillPipelineDescriptor(pipelineLayout, shaders, &storage);
+
+    wgpu::CreateRenderPipelineAsyncCallback<PendingRenderPipeline *> *callback =
+        [](wgpu::CreatePipelineAsyncStatus status, wgpu::RenderPipeline pipeline,
+           wgpu::StringView message, PendingRenderPipeline *pending) {
+            pending->completed = true;
+            pending->status    = status;
+            pending->pipeline  = std::move(pipeline);
+        };
+
+    // Dawn copies the descriptor, so the storage does not need to outlive the call.
+    return context->getDevice().CreateRenderPipelineAsync(
+        &storage.pipelineDesc, wgpu::CallbackMode::WaitAnyOnly, callback, userdata);
+}
+
 bool operator==(const RenderPipelineDesc &lhs, const RenderPipelineDesc &rhs)
 {
     return memcmp(&lhs, &rhs, sizeof(RenderPipelineDesc)) == 0;
 }
 
 // PipelineCache implementation.
-PipelineCache::PipelineCache()  = default;
-PipelineCache::~PipelineCache() = default;
+namespace
+{
+// Number of render pipelines kept per program.  Programs rarely see more than a handful of
+// distinct render states, so this only kicks in for applications that churn through formats or
+// blend states with a single program.
+constexpr size_t kMaxRenderPipelines = 128;
+// Number of pipeline descs stored in the warm up list of a program.
+constexpr size_t kMaxWarmUpListSize = 32;
+}  // namespace
+
+PipelineCache::PipelineCache() : mRenderPipelines(kMaxRenderPipelines) {}
+
+PipelineCache::~PipelineCache()
+{
+    ASSERT(mPendingRenderPipelines.empty());
+}
+
+void PipelineCache::destroy(ContextWgpu *context)
+{
+    // The pending pipelines hold pointers that the callbacks write to, so wait for them before
+    // freeing them.
+    if (!mPendingRenderPipelines.empty())
+    {
+        std::vector<wgpu::FutureWaitInfo> waitInfos;
+        for (const std::unique_ptr<PendingRenderPipeline> &pending : mPendingRenderPipelines)
+        {
+            wgpu::FutureWaitInfo &waitInfo = waitInfos.emplace_back();
+            waitInfo.future                = pending->future;
+        }
+        for (wgpu::FutureWaitInfo &waitInfo : waitInfos)
+        {
+            context->getInstance().WaitAny(1, &waitInfo, -1);
+        }
+        mPendingRenderPipelines.clear();
+    }
+
+    mRenderPipelines.Clear();
+}
 
 angle::Result PipelineCache::getRenderPipeline(ContextWgpu *context,
                                                const RenderPipelineDesc &desc,
@@ -475,15 +562,177 @@ angle::Result PipelineCache::getRenderPipeline(ContextWgpu *context,
                                                const gl::ShaderMap<wgpu::ShaderModule> &shaders,
                                                wgpu::RenderPipeline *pipelineOut)
 {
-    auto iter = mRenderPipelines.find(desc);
+    auto iter = mRenderPipelines.Get(desc);
     if (iter != mRenderPipelines.end())
     {
         *pipelineOut = iter->second;
         return angle::Result::Continue;
     }
 
+    if (!mPendingRenderPipelines.empty())
+    {
+        ANGLE_TRY(processPendingRenderPipelines(context, &desc));
+
+        iter = mRenderPipelines.Get(desc);
+        if (iter != mRenderPipelines.end())
+        {
+            *pipelineOut = iter->second;
+            return angle::Result::Continue;
+        }
+    }
+
     ANGLE_TRY(desc.createPipeline(context, pipelineLayout, shaders, pipelineOut));
-    mRenderPipelines.insert(std::make_pair(desc, *pipelineOut));
+    mRenderPipelines.Put(desc, wgpu::RenderPipeline(*pipelineOut));
+    mWarmUpListDirty = true;
+    ++mCreateCount;
+
+    return angle::Result::Continue;
+}
+
+void PipelineCache::loadWarmUpList(ContextWgpu *context,
+                                   const angle::BlobCacheKey &key,
+                                   const wgpu::PipelineLayout &pipelineLayout,
+                                   const gl::ShaderMap<wgpu::ShaderModule> &shaders)
+{
+    angle::BlobCacheValue value;
+    if (!context->getDisplay()->getBlob(key, &value))
+    {
+        return;
+    }
+
+    gl::BinaryInputStream stream(value.data(), value.size());
+    const size_t descCount = stream.readInt<size_t>();
+    if (stream.error() || descCount > kMaxWarmUpListSize)
+    {
+        return;
+    }
+
+    std::vector<RenderPipelineDesc> descs(descCount);
+    for (RenderPipelineDesc &desc : descs)
+    {
+        stream.readBytes(reinterpret_cast<uint8_t *>(&desc), sizeof(desc));
+    }
+    if (stream.error() || !stream.endOfStream())
+    {
+        WARN() << "Ignoring corrupted WebGPU render pipeline warm up list.";
+        return;
+    }
+
+    warmUp(context, descs, pipelineLayout, shaders);
+}
+
+void PipelineCache::saveWarmUpList(DisplayWgpu *display, const angle::BlobCacheKey &key)
+{
+    if (!mWarmUpListDirty)
+    {
+        return;
+    }
+
+    std::vector<RenderPipelineDesc> descs;
+    getWarmUpList(&descs);
+
+    gl::BinaryOutputStream stream;
+    stream.writeInt(descs.size());
+    for (const RenderPipelineDesc &desc : descs)
+    {
+        stream.writeBytes(reinterpret_cast<const uint8_t *>(&desc), sizeof(desc));
+    }
+
+    angle::MemoryBuffer value;
+    if (!value.resize(stream.length()))
+    {
+        return;
+    }
+    memcpy(value.data(), stream.data(), stream.length());
+
+    display->putBlob(key, value);
+    mWarmUpListDirty = false;
+}
+
+void PipelineCache::warmUp(ContextWgpu *context,
+                           const std::vector<RenderPipelineDesc> &descs,
+                           const wgpu::PipelineLayout &pipelineLayout,
+                           const gl::ShaderMap<wgpu::ShaderModule> &shaders)
+{
+    for (const RenderPipelineDesc &desc : descs)
+    {
+        if (mRenderPipelines.Peek(desc) != mRenderPipelines.end())
+        {
+            continue;
+        }
+
+        auto pending  = std::make_unique<PendingRenderPipeline>();
+        pending->desc = desc;
+        pending->future =
+            desc.createPipelineAsync(context, pipelineLayout, shaders, pending.get());
+        mPendingRenderPipelines.push_back(std::move(pending));
+        ++mAsyncCreateCount;
+    }
+}
+
+void PipelineCache::setCacheSizeForTesting(size_t cacheSize)
+{
+    // Reinsert the pipelines from least to most recently used, so the order is kept.
+    RenderPipelineMap resized(cacheSize);
+    for (auto iter = mRenderPipelines.rbegin(); iter != mRenderPipelines.rend(); ++iter)
+    {
+        resized.Put(iter->first, std::move(iter->second));
+    }
+    mRenderPipelines.Swap(resized);
+}
+
+void PipelineCache::getWarmUpList(std::vector<RenderPipelineDesc> *descsOut) const
+{
+    descsOut->clear();
+    for (auto iter = mRenderPipelines.begin();
+         iter != mRenderPipelines.end() && descsOut->size() < kMaxWarmUpListSize; ++iter)
+    {
+        descsOut->push_back(iter->first);
+    }
+}
+
+angle::Result PipelineCache::processPendingRenderPipelines(ContextWgpu *context,
+                                                           const RenderPipelineDesc *waitDesc)
+{
+    std::vector<wgpu::FutureWaitInfo> waitInfos;
+    wgpu::FutureWaitInfo waitDescInfo;
+    for (const std::unique_ptr<PendingRenderPipeline> &pending : mPendingRenderPipelines)
+    {
+        if (waitDesc && pending->desc == *waitDesc)
+        {
+            waitDescInfo.future = pending->future;
+        }
+        wgpu::FutureWaitInfo &waitInfo = waitInfos.emplace_back();
+        waitInfo.future                = pending->future;
+    }
+
+    // Run the callbacks of the pipelines that are already done without blocking.  A timed out
+    // wait is expected here.
+    wgpu::Instance instance = context->getInstance();
+    instance.WaitAny(waitInfos.size(), waitInfos.data(), 0);
+    if (waitDescInfo.future.id != 0)
+    {
+        ANGLE_WGPU_TRY(context, instance.WaitAny(1, &waitDescInfo, -1));
+    }
+
+    for (std::unique_ptr<PendingRenderPipeline> &pending : mPendingRenderPipelines)
+    {
+        if (!pending->completed)
+        {
+            continue;
+        }
+        // A failed warm up is not an error; the pipeline is created synchronously if a draw
+        // needs it, which reports the error.
+        if (pending->status == wgpu::CreatePipelineAsyncStatus::Success &&
+            mRenderPipelines.Peek(pending->desc) == mRenderPipelines.end())
+        {
+            mRenderPipelines.Put(pending->desc, std::move(pending->pipeline));
+        }
+        pending.reset();
+    }
+    mPendingRenderPipelines.erase(
+        std::remove(mPendingRenderPipelines.begin(), mPendingRenderPipelines.end(), nullptr),
+        mPendingRenderPipelines.end());
 
     return angle::Result::Continue;
 }
@@ -7,9 +7,12 @@
 #ifndef LIBANGLE_RENDERER_WGPU_PIPELINE_STATE_H_
 #define LIBANGLE_RENDERER_WGPU_PIPELINE_STATE_H_
 
+#include <anglebase/containers/mru_cache.h>
 #include <dawn/webgpu_cpp.h>
 #include <stdint.h>
 #include <limits>
+#include <memory>
+#include <vector>
 
 #include "libANGLE/Constants.h"
 #include "libANGLE/Error.h"
@@ -20,6 +23,7 @@
 namespace rx
 {
 class ContextWgpu;
+class DisplayWgpu;
 
 namespace webgpu
 {
@@ -124,6 +128,9 @@ struct PackedVertexAttribute final
 constexpr size_t kPackedVertexAttributeSize = sizeof(PackedVertexAttribute);
 static_assert(kPackedVertexAttributeSize == 6, "Size mismatch");
 
+struct PendingRenderPipeline;
+struct RenderPipelineDescriptorStorage;
+
 class RenderPipelineDesc final
 {
   public:
@@ -170,8 +177,18 @@ class RenderPipelineDesc final
                                  const wgpu::PipelineLayout &pipelineLayout,
                                  const gl::ShaderMap<wgpu::ShaderModule> &shaders,
                                  wgpu::RenderPipeline *pipelineOut) const;
+    // Starts creating the pipeline in the background. |userdata| is written once the returned
+    // future has completed in wgpu::Instance::WaitAny().
+    wgpu::Future createPipelineAsync(ContextWgpu *context,
+                                     const wgpu::PipelineLayout &pipelineLayout,
+                                     const gl::ShaderMap<wgpu::ShaderModule> &shaders,
+                                     PendingRenderPipeline *userdata) const;
 
   private:
+    void fillPipelineDescriptor(const wgpu::PipelineLayout &pipelineLayout,
+                                const gl::ShaderMap<wgpu::ShaderModule> &shaders,
+                                RenderPipelineDescriptorStorage *storage) const;
+
     PackedVertexAttribute mVertexAttributes[gl::MAX_VERTEX_ATTRIBS];
     PackedColorTargetState mColorTargetStates[gl::IMPLEMENTATION_MAX_DRAW_BUFFERS];
     PackedDepthStencilState mDepthStencilState;
@@ -205,20 +222,77 @@ namespace rx
 namespace webgpu
 {
 
+struct PendingRenderPipeline
+{
+    RenderPipelineDesc desc;
+    wgpu::Future future;
+    bool completed                         = false;
+    wgpu::CreatePipelineAsyncStatus status = wgpu::CreatePipelineAsyncStatus::Success;
+    wgpu::RenderPipeline pipeline;
+};
+
+// Caches the render pipelines of a single program.  The least recently used pipelines are evicted
+// once the cache holds more than kMaxRenderPipelines of them.
+//
+// The descs of the most recently used pipelines form the warm up list, which is stored in the blob
+// cache when the program is destroyed.  The next time a program with the same shaders is used, the
+// pipelines of the list are created asynchronously by Dawn so that draws that need them later do
+// not have to wait for a synchronous pipeline creation.
 class PipelineCache final
 {
   public:
     PipelineCache();
     ~PipelineCache();
 
+    void destroy(ContextWgpu *context);
+
     angle::Result getRenderPipeline(ContextWgpu *context,
                                     const RenderPipelineDesc &desc,
                                     const wgpu::PipelineLayout &pipelineLayout,
                                     const gl::ShaderMap<wgpu::ShaderModule> &shaders,
                                     wgpu::RenderPipeline *pipelineOut);
 
+    // Starts creating the pipelines of the warm up list stored under |key|, if any.
+    void loadWarmUpList(ContextWgpu *context,
+                        const angle::BlobCacheKey &key,
+                        const wgpu::PipelineLayout &pipelineLayout,
+                        const gl::ShaderMap<wgpu::ShaderModule> &shaders);
+    // Stores the warm up list under |key| if pipelines were created since it was loaded.
+    void saveWarmUpList(DisplayWgpu *display, const angle::BlobCacheKey &key);
+
+    void warmUp(ContextWgpu *context,
+                const std::vector<RenderPipelineDesc> &descs,
+                const wgpu::PipelineLayout &pipelineLayout,
+                const gl::ShaderMap<wgpu::ShaderModule> &shaders);
+    // Returns the descs of the most recently used pipelines, most recent first.
+    void getWarmUpList(std::vector<RenderPipelineDesc> *descsOut) const;
+
+    size_t size() const { return mRenderPipelines.size(); }
+
+    // Testing only: changes the number of pipelines kept in the cache, evicting the least recently
+    // used ones if needed.
+    void setCacheSizeForTesting(size_t cacheSize);
+    // Testing only: the number of pipelines created synchronously by draws and asynchronously by
+    // warm up, respectively.
+    uint32_t getCreateCountForTesting() const { return mCreateCount; }
+    uint32_t getAsyncCreateCountForTesting() const { return mAsyncCreateCount; }
+
   private:
-    std::unordered_map<RenderPipelineDesc, wgpu::RenderPipeline> mRenderPipelines;
+    // Moves the pipelines that finished creating in the background to the cache.  If |waitDesc|
+    // is being created, waits for it to finish.
+    angle::Result processPendingRenderPipelines(ContextWgpu *context,
+                                                const RenderPipelineDesc *waitDesc);
+
+    using RenderPipelineMap =
+        angle::base::HashingMRUCache<RenderPipelineDesc, wgpu::RenderPipeline>;
+
+    RenderPipelineMap mRenderPipelines;
+    std::vector<std::unique_ptr<PendingRenderPipeline>> mPendingRenderPipelines;
+    // Set when a pipeline missing from the warm up list is created.
+    bool mWarmUpListDirty = false;
+
+    uint32_t mCreateCount      = 0;
+    uint32_t mAsyncCreateCount = 0;
 };
 
 }  // namespace webgpu
@@ -2969,73 +2969,6 @@ bool ValidateUniformMatrixValue(const Context *context,
     return false;
 }
 
-bool ValidateUniform(const Context *context,
-                     angle::EntryPoint entryPoint,
-                     GLenum valueType,
-                     UniformLocation location,
-                     GLsizei count)
-{
-    const LinkedUniform *uniform = nullptr;
-    Program *programObject       = context->getActiveLinkedProgram();
-    if (!ValidateUniformCommonBase(context, entryPoint, programObject, location, count, &uniform))
-    {
-        // Error already generated.
-        return false;
-    }
-    if (uniform == nullptr)
-    {
-        return true;  // no-op
-    }
-    return ValidateUniformValue(context, entryPoint, valueType, uniform->getType());
-}
-
-bool ValidateUniform1iv(const Context *context,
-                        angle::EntryPoint entryPoint,
-                        UniformLocation location,
-                        GLsizei count,
-                        const GLint *value)
-{
-    const LinkedUniform *uniform = nullptr;
-    Program *programObject       = context->getActiveLinkedProgram();
-    if (!ValidateUniformCommonBase(context, entryPoint, programObject, location, count, &uniform))
-    {
-        // Error already generated.
-        return false;
-    }
-    if (uniform == nullptr)
-    {
-        return true;  // no-op
-    }
-    return ValidateUniform1ivValue(context, entryPoint, uniform->getType(), count, value);
-}
-
-bool ValidateUniformMatrix(const Context *context,
-                           angle::EntryPoint entryPoint,
-                           GLenum valueType,
-                           UniformLocation location,
-                           GLsizei count,
-                           GLboolean transpose)
-{
-    if (ConvertToBool(transpose) && context->getClientMajorVersion() < 3)
-    {
-        ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, kES3Required);
-        return false;
-    }
-
-    const LinkedUniform *uniform = nullptr;
-    Program *programObject       = context->getActiveLinkedProgram();
-    if (!ValidateUniformCommonBase(context, entryPoint, programObject, location, count, &uniform))
-    {
-        // Error already generated.
-        return false;
-    }
-    if (uniform == nullptr)
-    {
-        return true;  // no-op
-    }
-    return ValidateUniformMatrixValue(context, entryPoint, valueType, uniform->getType());
-}
-
 bool ValidateStateQuery(const Context *context,
                         angle::EntryPoint entryPoint,
                         GLenum pname,
@@ -318,8 +318,13 @@ bool ValidateGetQueryObjectui64vRobustANGLE(const Context *context,
                                             const GLsizei *length,
                                             GLuint64 *params);
 
+// Validates setting |count| values of |valueType| at |location| of |program|.  |uniformOut| is only
+// set if the uniform's type is not exactly |valueType|, in which case the caller checks whether the
+// two types are compatible.  It is left null when there is nothing left to check, which includes
+// the no-op cases.
 ANGLE_INLINE bool ValidateUniformCommonBase(const Context *context,
                                             angle::EntryPoint entryPoint,
+                                            GLenum valueType,
                                             const Program *program,
                                             UniformLocation location,
                                             GLsizei count,
@@ -379,6 +384,11 @@ ANGLE_INLINE bool ValidateUniformCommonBase(const Context *context,
         return false;
     }
 
+    if (ANGLE_LIKELY(uniform.getType() == valueType))
+    {
+        return true;
+    }
+
     *uniformOut = &uniform;
     return true;
 }
@@ -409,17 +419,56 @@ bool ValidateUniformMatrixValue(const Context *context,
                                 angle::EntryPoint entryPoint,
                                 GLenum valueType,
                                 GLenum uniformType);
-bool ValidateUniform(const Context *context,
-                     angle::EntryPoint entryPoint,
-                     GLenum uniformType,
-                     UniformLocation location,
-                     GLsizei count);
-bool ValidateUniformMatrix(const Context *context,
-                           angle::EntryPoint entryPoint,
-                           GLenum matrixType,
-                           UniformLocation location,
-                           GLsizei count,
-                           GLboolean transpose);
+
+ANGLE_INLINE bool ValidateUniform(const Context *context,
+                                  angle::EntryPoint entryPoint,
+                                  GLenum valueType,
+                                  UniformLocation location,
+                                  GLsizei count)
+{
+    const LinkedUniform *uniform = nullptr;
+    Program *programObject       = context->getActiveLinkedProgram();
+    if (!ValidateUniformCommonBase(context, entryPoint, valueType, programObject, location, count,
+                                   &uniform))
+    {
+        // Error already generated.
+        return false;
+    }
+    if (uniform == nullptr)
+    {
+        return true;
+    }
+    return ValidateUniformValue(context, entryPoint, valueType, uniform->getType());
+}
+
+ANGLE_INLINE bool ValidateUniformMatrix(const Context *context,
+                                        angle::EntryPoint entryPoint,
+                                        GLenum valueType,
+                                        UniformLocation location,
+                                        GLsizei count,
+                                        GLboolean transpose)
+{
+    if (ANGLE_UNLIKELY(transpose != GL_FALSE) && context->getClientMajorVersion() < 3)
+    {
+        ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, err::kES3Required);
+        return false;
+    }
+
+    const LinkedUniform *uniform = nullptr;
+    Program *programObject       = context->getActiveLinkedProgram();
+    if (!ValidateUniformCommonBase(context, entryPoint, valueType, programObject, location, count,
+                                   &uniform))
+    {
+        // Error already generated.
+        return false;
+    }
+    if (uniform == nullptr)
+    {
+        return true;
+    }
+    return ValidateUniformMatrixValue(context, entryPoint, valueType, uniform->getType());
+}
+
 bool ValidateGetBooleanvRobustANGLE(const Context *context,
                                     angle::EntryPoint entryPoint,
                                     GLenum pname,
@@ -3973,27 +3973,6 @@ bool ValidateDisableExtensionANGLE(const Context *context,
     return true;
 }
 
-bool ValidateActiveTexture(const PrivateState &state,
-                           ErrorSet *errors,
-                           angle::EntryPoint entryPoint,
-                           GLenum texture)
-{
-    if (state.getClientMajorVersion() < 2)
-    {
-        return ValidateMultitextureUnit(state, errors, entryPoint, texture);
-    }
-
-    if (texture < GL_TEXTURE0 ||
-        texture >
-            GL_TEXTURE0 + static_cast<GLuint>(state.getCaps().maxCombinedTextureImageUnits) - 1)
-    {
-        errors->validationError(entryPoint, GL_INVALID_ENUM, kInvalidCombinedImageUnit);
-        return false;
-    }
-
-    return true;
-}
-
 bool ValidateAttachShader(const Context *context,
                           angle::EntryPoint entryPoint,
                           ShaderProgramID program,
@@ -4561,32 +4540,6 @@ bool ValidateDetachShader(const Context *context,
     return true;
 }
 
-bool ValidateDisableVertexAttribArray(const Context *context,
-                                      angle::EntryPoint entryPoint,
-                                      GLuint index)
-{
-    if (index >= static_cast<GLuint>(context->getCaps().maxVertexAttributes))
-    {
-        ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, kIndexExceedsMaxVertexAttribute);
-        return false;
-    }
-
-    return true;
-}
-
-bool ValidateEnableVertexAttribArray(const Context *context,
-                                     angle::EntryPoint entryPoint,
-                                     GLuint index)
-{
-    if (index >= static_cast<GLuint>(context->getCaps().maxVertexAttributes))
-    {
-        ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, kIndexExceedsMaxVertexAttribute);
-        return false;
-    }
-
-    return true;
-}
-
 bool ValidateFinish(const Context *context, angle::EntryPoint entryPoint)
 {
     if (context->getState().getPixelLocalStorageActivePlanes() != 0)
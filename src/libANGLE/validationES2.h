@@ -24,6 +24,27 @@ ANGLE_INLINE bool ValidateDrawArrays(const Context *context,
     return ValidateDrawArraysCommon(context, entryPoint, mode, first, count, 1);
 }
 
+ANGLE_INLINE bool ValidateUniform1iv(const Context *context,
+                                     angle::EntryPoint entryPoint,
+                                     UniformLocation location,
+                                     GLsizei count,
+                                     const GLint *value)
+{
+    const LinkedUniform *uniform = nullptr;
+    Program *programObject       = context->getActiveLinkedProgram();
+    if (!ValidateUniformCommonBase(context, entryPoint, GL_INT, programObject, location, count,
+                                   &uniform))
+    {
+        // Error already generated.
+        return false;
+    }
+    if (uniform == nullptr)
+    {
+        return true;
+    }
+    return ValidateUniform1ivValue(context, entryPoint, uniform->getType(), count, value);
+}
+
 ANGLE_INLINE bool ValidateUniform1f(const Context *context,
                                     angle::EntryPoint entryPoint,
                                     UniformLocation location,
@@ -580,6 +601,47 @@ ANGLE_INLINE bool ValidateVertexAttribPointer(const Context *context,
     return true;
 }
 
+ANGLE_INLINE bool ValidateEnableVertexAttribArray(const Context *context,
+                                                  angle::EntryPoint entryPoint,
+                                                  GLuint index)
+{
+    if (ANGLE_UNLIKELY(index >= static_cast<GLuint>(context->getCaps().maxVertexAttributes)))
+    {
+        ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, err::kIndexExceedsMaxVertexAttribute);
+        return false;
+    }
+
+    return true;
+}
+
+ANGLE_INLINE bool ValidateDisableVertexAttribArray(const Context *context,
+                                                   angle::EntryPoint entryPoint,
+                                                   GLuint index)
+{
+    return ValidateEnableVertexAttribArray(context, entryPoint, index);
+}
+
+ANGLE_INLINE bool ValidateActiveTexture(const PrivateState &state,
+                                        ErrorSet *errors,
+                                        angle::EntryPoint entryPoint,
+                                        GLenum texture)
+{
+    if (ANGLE_UNLIKELY(state.getClientMajorVersion() < 2))
+    {
+        return ValidateMultitextureUnit(state, errors, entryPoint, texture);
+    }
+
+    // Unsigned wrap around makes values below GL_TEXTURE0 fail the range check too.
+    const GLuint unit = texture - GL_TEXTURE0;
+    if (ANGLE_UNLIKELY(unit >= static_cast<GLuint>(state.getCaps().maxCombinedTextureImageUnits)))
+    {
+        errors->validationError(entryPoint, GL_INVALID_ENUM, err::kInvalidCombinedImageUnit);
+        return false;
+    }
+
+    return true;
+}
+
 void RecordBindTextureTypeError(const Context *context,
                                 angle::EntryPoint entryPoint,
                                 TextureType target);
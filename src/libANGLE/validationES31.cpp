@@ -333,7 +333,8 @@ bool ValidateProgramUniformBase(const Context *context,
     }
 
     const LinkedUniform *uniform = nullptr;
-    if (!ValidateUniformCommonBase(context, entryPoint, programObject, location, count, &uniform))
+    if (!ValidateUniformCommonBase(context, entryPoint, valueType, programObject, location, count,
+                                   &uniform))
     {
         // Error already generated.
         return false;
@@ -361,7 +362,8 @@ bool ValidateProgramUniformMatrixBase(const Context *context,
     }
 
     const LinkedUniform *uniform = nullptr;
-    if (!ValidateUniformCommonBase(context, entryPoint, programObject, location, count, &uniform))
+    if (!ValidateUniformCommonBase(context, entryPoint, valueType, programObject, location, count,
+                                   &uniform))
     {
         // Error already generated.
         return false;
@@ -774,7 +776,8 @@ bool ValidateProgramUniform1ivBase(const Context *context,
     }
 
     const LinkedUniform *uniform = nullptr;
-    if (!ValidateUniformCommonBase(context, entryPoint, programObject, location, count, &uniform))
+    if (!ValidateUniformCommonBase(context, entryPoint, GL_INT, programObject, location, count,
+                                   &uniform))
     {
         // Error already generated.
         return false;
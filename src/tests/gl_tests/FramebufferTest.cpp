@@ -580,6 +580,83 @@ class FramebufferTest_ES3 : public ANGLETest<>
         setConfigStencilBits(8);
     }
 
+    // Draws a pattern to the default framebuffer where the red channel of every pixel is its x
+    // coordinate and the green channel is its y coordinate.  Reading it back verifies that the
+    // pixels are not rotated or flipped, including with emulated pre-rotation.
+    void drawPositionPattern()
+    {
+        constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+out vec4 colorOut;
+void main()
+{
+    colorOut = vec4(floor(gl_FragCoord.xy) / 255.0, 0, 1);
+})";
+
+        ANGLE_GL_PROGRAM(program, essl3_shaders::vs::Simple(), kFS);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(0, 0, kWidth, kHeight);
+        drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+        ASSERT_GL_NO_ERROR();
+    }
+
+    void verifyPositionPattern(const GLColor *pixels,
+                               GLint x,
+                               GLint y,
+                               GLsizei width,
+                               GLsizei height)
+    {
+        for (GLsizei row = 0; row < height; ++row)
+        {
+            for (GLsizei column = 0; column < width; ++column)
+            {
+                const GLColor expected(x + column, y + row, 0, 255);
+                ASSERT_EQ(expected, pixels[row * width + column])
+                    << "at (" << x + column << ", " << y + row << ")";
+            }
+        }
+    }
+
+    // Reads back |width|x|height| pixels at (|x|, |y|) of the position pattern, either to client
+    // memory or to a pixel pack buffer at a non-zero offset.
+    void readAndVerifyPositionPattern(GLint x,
+                                      GLint y,
+                                      GLsizei width,
+                                      GLsizei height,
+                                      bool usePixelPackBuffer)
+    {
+        std::vector<GLColor> pixels(width * height);
+
+        if (!usePixelPackBuffer)
+        {
+            glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+            ASSERT_GL_NO_ERROR();
+            verifyPositionPattern(pixels.data(), x, y, width, height);
+            return;
+        }
+
+        constexpr GLintptr kPackOffset = 16 * sizeof(GLColor);
+        const GLsizeiptr readSize      = pixels.size() * sizeof(GLColor);
+
+        GLBuffer packBuffer;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, packBuffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, kPackOffset + readSize, nullptr, GL_STREAM_READ);
+        glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE,
+                     reinterpret_cast<void *>(kPackOffset));
+        ASSERT_GL_NO_ERROR();
+
+        const void *mapped =
+            glMapBufferRange(GL_PIXEL_PACK_BUFFER, kPackOffset, readSize, GL_MAP_READ_BIT);
+        ASSERT_NE(mapped, nullptr);
+        memcpy(pixels.data(), mapped, readSize);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        ASSERT_GL_NO_ERROR();
+
+        verifyPositionPattern(pixels.data(), x, y, width, height);
+    }
+
     static constexpr GLsizei kWidth  = 64;
     static constexpr GLsizei kHeight = 256;
 };
@@ -882,6 +959,26 @@ TEST_P(FramebufferTest_ES3, InvalidateDefaultFramebuffer)
     EXPECT_GL_NO_ERROR();
 }
 
+// Test that reading back the default framebuffer to client memory returns correctly oriented
+// pixels.  With emulated pre-rotation, the surface is rotated relative to the GL coordinates.
+TEST_P(FramebufferTest_ES3, ReadPixelsDefaultFramebufferOrientation)
+{
+    drawPositionPattern();
+
+    readAndVerifyPositionPattern(0, 0, kWidth, kHeight, false);
+    readAndVerifyPositionPattern(5, 17, 13, 40, false);
+}
+
+// Same as above, but reading back to a pixel pack buffer.  Rotated and y-flipped readbacks into
+// a buffer may be transformed on the GPU.
+TEST_P(FramebufferTest_ES3, ReadPixelsDefaultFramebufferOrientationToPixelPackBuffer)
+{
+    drawPositionPattern();
+
+    readAndVerifyPositionPattern(0, 0, kWidth, kHeight, true);
+    readAndVerifyPositionPattern(5, 17, 13, 40, true);
+}
+
 // Test that invalidating combined depth/stencil attachment doesn't crash.
 TEST_P(FramebufferTest_ES3, InvalidateDepthStencil)
 {
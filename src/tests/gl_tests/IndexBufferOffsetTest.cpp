@@ -609,6 +609,68 @@ TEST_P(IndexBufferOffsetTest, DrawWithDifferentCountsSameOffset)
     EXPECT_GL_NO_ERROR();
 }
 
-ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(IndexBufferOffsetTest);
+// Uses uint8 indices far into the index buffer, at an offset that is not a multiple of the storage
+// buffer offset alignment.  Backends that widen the indices on the GPU bind only part of the
+// buffer.
+TEST_P(IndexBufferOffsetTest, UInt8IndexAtLargeOffset)
+{
+    constexpr GLubyte kIndices[] = {0, 1, 2, 1, 2, 3};
+    constexpr size_t kOffset     = 1001;
+
+    std::vector<GLubyte> indexData(2048, 0);
+    memcpy(indexData.data() + kOffset, kIndices, sizeof(kIndices));
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexData.size(), indexData.data(), GL_STATIC_DRAW);
+    glUseProgram(mProgram);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glVertexAttribPointer(mPositionAttributeLocation, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(mPositionAttributeLocation);
+
+    glUniform4f(mColorUniformLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, reinterpret_cast<void *>(kOffset));
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), GLColor::red);
+    EXPECT_GL_NO_ERROR();
+}
+
+class IndexBufferPrimitiveRestartTest : public IndexBufferOffsetTest
+{};
+
+// Draws a triangle strip from uint8 indices in an index buffer with primitive restart enabled.
+// Backends that widen the indices must translate the restart index as well.
+TEST_P(IndexBufferPrimitiveRestartTest, UInt8Index)
+{
+    constexpr GLubyte kIndices[] = {0, 1, 2, 0xFF, 1, 2, 3};
+    constexpr size_t kOffset     = 3;
+
+    std::vector<GLubyte> indexData(kOffset + sizeof(kIndices), 0);
+    memcpy(indexData.data() + kOffset, kIndices, sizeof(kIndices));
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexData.size(), indexData.data(), GL_STATIC_DRAW);
+    glUseProgram(mProgram);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glVertexAttribPointer(mPositionAttributeLocation, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(mPositionAttributeLocation);
+
+    glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+    glUniform4f(mColorUniformLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+    glDrawElements(GL_TRIANGLE_STRIP, 7, GL_UNSIGNED_BYTE, reinterpret_cast<void *>(kOffset));
+
+    // Each half of the strip draws one triangle of the quad.
+    EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), GLColor::green);
+    EXPECT_GL_NO_ERROR();
+}
+
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(IndexBufferOffsetTest, ES2_WEBGPU());
 
 ANGLE_INSTANTIATE_TEST_ES3(IndexBufferOffsetTestES3);
+
+ANGLE_INSTANTIATE_TEST_ES3_AND(IndexBufferPrimitiveRestartTest, ES3_WEBGPU());
@@ -371,6 +371,46 @@ TEST_P(LineLoopTest, LineLoopUIntIndexBufferNoBlend)
     runTestNoBlend(GL_UNSIGNED_INT, buf, reinterpret_cast<const void *>(sizeof(GLuint)));
 }
 
+// Line loop test with the indices far into the index buffer, at an offset that is not a multiple of
+// the storage buffer offset alignment.  Backends that convert the indices on the GPU bind only part
+// of the buffer.
+TEST_P(LineLoopTest, LineLoopUByteIndexBufferLargeOffset)
+{
+    // http://anglebug.com/42265165: Disable D3D11 SDK Layers warnings checks.
+    ignoreD3D11SDKLayersWarnings();
+
+    static const GLubyte indices[] = {7, 6, 9, 8};
+    constexpr size_t kOffset       = 1027;
+
+    std::vector<GLubyte> bufferData(2048, 0);
+    memcpy(bufferData.data() + kOffset, indices, sizeof(indices));
+
+    GLBuffer buf;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferData.size(), bufferData.data(), GL_STATIC_DRAW);
+
+    runTestBlend(GL_UNSIGNED_BYTE, buf, reinterpret_cast<const void *>(kOffset));
+}
+
+// Same as above with uint16 indices at an offset that is not a multiple of four.
+TEST_P(LineLoopTest, LineLoopUShortIndexBufferLargeOffset)
+{
+    // http://anglebug.com/42265165: Disable D3D11 SDK Layers warnings checks.
+    ignoreD3D11SDKLayersWarnings();
+
+    static const GLushort indices[] = {7, 6, 9, 8};
+    constexpr size_t kOffset        = 1026;
+
+    std::vector<GLubyte> bufferData(2048, 0);
+    memcpy(bufferData.data() + kOffset, indices, sizeof(indices));
+
+    GLBuffer buf;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferData.size(), bufferData.data(), GL_STATIC_DRAW);
+
+    runTestBlend(GL_UNSIGNED_SHORT, buf, reinterpret_cast<const void *>(kOffset));
+}
+
 // Test that drawing elements between line loop arrays using the same array buffer does not result
 // in incorrect rendering.
 TEST_P(LineLoopTest, DrawTriangleElementsBetweenArrays)
@@ -312,6 +312,50 @@ class ProgramBinaryES31Test : public ANGLETest<>
         glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS_OES, &formatCount);
         return formatCount;
     }
+
+    void getProgramBinary(GLuint program, std::vector<uint8_t> *binaryOut, GLenum *formatOut)
+    {
+        GLint programLength = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &programLength);
+        ASSERT_GL_NO_ERROR();
+
+        GLsizei readLength = 0;
+        binaryOut->resize(programLength);
+        glGetProgramBinary(program, programLength, &readLength, formatOut, binaryOut->data());
+        ASSERT_GL_NO_ERROR();
+        EXPECT_EQ(static_cast<GLsizei>(programLength), readLength);
+    }
+
+    // Returns the name of every active buffer variable along with the index queried back by name.
+    std::vector<std::pair<std::string, GLuint>> getBufferVariables(GLuint program)
+    {
+        GLint count = 0;
+        glGetProgramInterfaceiv(program, GL_BUFFER_VARIABLE, GL_ACTIVE_RESOURCES, &count);
+
+        std::vector<std::pair<std::string, GLuint>> bufferVariables;
+        for (GLint index = 0; index < count; ++index)
+        {
+            GLchar name[64] = {};
+            glGetProgramResourceName(program, GL_BUFFER_VARIABLE, index, sizeof(name), nullptr,
+                                     name);
+            GLuint queriedIndex = glGetProgramResourceIndex(program, GL_BUFFER_VARIABLE, name);
+            bufferVariables.emplace_back(name, queriedIndex);
+        }
+        EXPECT_GL_NO_ERROR();
+        return bufferVariables;
+    }
+
+    static constexpr char kBufferVariableCS[] = R"(#version 310 es
+layout(local_size_x=1, local_size_y=1, local_size_z=1) in;
+layout(std430, binding = 0) buffer Block {
+    uint a;
+    vec4 b[2];
+} inst;
+uniform uint uValue;
+void main() {
+    inst.a = uValue;
+    inst.b[1] = vec4(1.0);
+})";
 };
 
 void ProgramBinaryES3Test::testBinaryAndUBOBlockIndexes(bool drawWithProgramFirst)
@@ -1377,6 +1421,79 @@ TEST_P(ProgramBinaryES31Test, ImageTextureBinding)
     ASSERT_GL_NO_ERROR();
 }
 
+// Tests that buffer variable reflection, which is decoded lazily after a binary is loaded, matches
+// the reflection of the original program.
+TEST_P(ProgramBinaryES31Test, BufferVariableReflection)
+{
+    ANGLE_SKIP_TEST_IF(getAvailableProgramBinaryFormatCount() == 0);
+
+    ANGLE_GL_COMPUTE_PROGRAM(program, kBufferVariableCS);
+    const std::vector<std::pair<std::string, GLuint>> expected = getBufferVariables(program);
+    ASSERT_EQ(2u, expected.size());
+
+    std::vector<uint8_t> binary;
+    GLenum binaryFormat = GL_NONE;
+    getProgramBinary(program, &binary, &binaryFormat);
+
+    ANGLE_GL_BINARY_ES3_PROGRAM(binaryProgram, binary, binaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expected, getBufferVariables(binaryProgram));
+    EXPECT_EQ(GL_INVALID_INDEX,
+              glGetProgramResourceIndex(binaryProgram, GL_BUFFER_VARIABLE, "Block.c"));
+}
+
+// Tests that a loaded program saved again before its lazy reflection is decoded produces a binary
+// that still carries the reflection and the backend's mapped names.
+TEST_P(ProgramBinaryES31Test, ResaveBeforeReflectionIsDecoded)
+{
+    ANGLE_SKIP_TEST_IF(getAvailableProgramBinaryFormatCount() == 0);
+
+    ANGLE_GL_COMPUTE_PROGRAM(program, kBufferVariableCS);
+    const std::vector<std::pair<std::string, GLuint>> expected = getBufferVariables(program);
+
+    std::vector<uint8_t> binary;
+    GLenum binaryFormat = GL_NONE;
+    getProgramBinary(program, &binary, &binaryFormat);
+
+    // Save the loaded program without querying anything that would decode its reflection.
+    ANGLE_GL_BINARY_ES3_PROGRAM(binaryProgram, binary, binaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    std::vector<uint8_t> resavedBinary;
+    GLenum resavedBinaryFormat = GL_NONE;
+    getProgramBinary(binaryProgram, &resavedBinary, &resavedBinaryFormat);
+
+    ANGLE_GL_BINARY_ES3_PROGRAM(reloadedProgram, resavedBinary, resavedBinaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expected, getBufferVariables(reloadedProgram));
+
+    // Make sure the reloaded program still works, which needs the mapped uniform names on the GL
+    // backend.
+    constexpr GLuint kValue = 42u;
+    std::array<GLuint, 12> zeros{};
+    GLBuffer buffer;
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(zeros), zeros.data(), GL_STATIC_DRAW);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, buffer);
+
+    glUseProgram(reloadedProgram);
+    GLint location = glGetUniformLocation(reloadedProgram, "uValue");
+    ASSERT_NE(-1, location);
+    glUniform1ui(location, kValue);
+    glDispatchCompute(1, 1, 1);
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    ASSERT_GL_NO_ERROR();
+
+    const GLuint *result = static_cast<const GLuint *>(
+        glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, sizeof(GLuint), GL_MAP_READ_BIT));
+    ASSERT_NE(nullptr, result);
+    EXPECT_EQ(kValue, result[0]);
+    glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+    ASSERT_GL_NO_ERROR();
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ProgramBinaryES31Test);
 ANGLE_INSTANTIATE_TEST_ES31(ProgramBinaryES31Test);
 
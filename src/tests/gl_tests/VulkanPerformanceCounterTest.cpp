@@ -7587,6 +7587,119 @@ TEST_P(VulkanPerformanceCounterTest, ResizeFBOAttachedTexture)
     EXPECT_EQ(framebufferCacheSizeIncrease, expectedFramebufferCacheSizeIncrease);
 }
 
+// Test that rendering to many differently configured framebuffers over many frames does not make
+// the render pass cache grow without bound.
+TEST_P(VulkanPerformanceCounterTest, RenderPassCacheStaysBounded)
+{
+    // The render pass cache is not used with dynamic rendering.
+    ANGLE_SKIP_TEST_IF(isFeatureEnabled(Feature::PreferDynamicRendering));
+
+    // Match the budget and retire age of RenderPassCache.
+    constexpr size_t kMaxCachedRenderPasses = 256;
+    constexpr size_t kRenderPassRetireAge   = 10;
+
+    constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+layout(location = 0) out vec4 color0;
+layout(location = 1) out vec4 color1;
+layout(location = 2) out vec4 color2;
+layout(location = 3) out vec4 color3;
+void main()
+{
+    color0 = vec4(1, 0, 0, 1);
+    color1 = vec4(0, 1, 0, 1);
+    color2 = vec4(0, 0, 1, 1);
+    color3 = vec4(1, 1, 0, 1);
+})";
+
+    ANGLE_GL_PROGRAM(program, essl3_shaders::vs::Simple(), kFS);
+
+    // Each of the four color attachment slots is either empty or uses one of these formats, with
+    // or without a depth/stencil attachment, which gives 2 * (4^4 - 1) = 510 configurations.
+    constexpr GLenum kColorFormats[] = {GL_R8, GL_RG8, GL_RGBA8};
+    constexpr size_t kColorFormatCount = ArraySize(kColorFormats);
+    constexpr size_t kSlotCount        = 4;
+    constexpr GLsizei kSize            = 4;
+
+    GLTexture colorTextures[kSlotCount][kColorFormatCount];
+    for (size_t slot = 0; slot < kSlotCount; ++slot)
+    {
+        for (size_t format = 0; format < kColorFormatCount; ++format)
+        {
+            glBindTexture(GL_TEXTURE_2D, colorTextures[slot][format]);
+            glTexStorage2D(GL_TEXTURE_2D, 1, kColorFormats[format], kSize, kSize);
+        }
+    }
+    GLRenderbuffer depthStencil;
+    glBindRenderbuffer(GL_RENDERBUFFER, depthStencil);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, kSize, kSize);
+    ASSERT_GL_NO_ERROR();
+
+    size_t configCount = 1;
+    for (size_t slot = 0; slot < kSlotCount; ++slot)
+    {
+        configCount *= kColorFormatCount + 1;
+    }
+
+    // Render every configuration once, spread over more frames than the retire age.
+    constexpr size_t kConfigsPerFrame = 16;
+    GLFramebuffer fbo;
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glViewport(0, 0, kSize, kSize);
+
+    size_t configsRendered = 0;
+    for (size_t withDepthStencil = 0; withDepthStencil < 2; ++withDepthStencil)
+    {
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER,
+                                  withDepthStencil ? depthStencil.get() : 0);
+
+        // Configuration 0 has no attachments at all; skip it.
+        for (size_t config = 1; config < configCount; ++config)
+        {
+            GLenum drawBuffers[kSlotCount];
+            size_t formats = config;
+            for (size_t slot = 0; slot < kSlotCount; ++slot)
+            {
+                const size_t format = formats % (kColorFormatCount + 1);
+                formats /= kColorFormatCount + 1;
+
+                const GLenum attachment = GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(slot);
+                const GLuint texture =
+                    format == kColorFormatCount ? 0 : colorTextures[slot][format].get();
+                glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, texture, 0);
+                drawBuffers[slot] = texture == 0 ? GL_NONE : attachment;
+            }
+            glDrawBuffers(kSlotCount, drawBuffers);
+            ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+            drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+            ASSERT_GL_NO_ERROR();
+
+            if (++configsRendered % kConfigsPerFrame == 0)
+            {
+                swapBuffers();
+
+                // At most a compatible render pass and one with ops are created per configuration,
+                // and only those of the last frames can't be evicted yet.
+                EXPECT_LE(getPerfCounters().renderPassCacheSize,
+                          kMaxCachedRenderPasses +
+                              2 * kConfigsPerFrame * (kRenderPassRetireAge + 1));
+            }
+        }
+    }
+    ASSERT_GT(configsRendered / kConfigsPerFrame, kRenderPassRetireAge);
+
+    // Once the configurations are no longer used, the cache shrinks back within budget.
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    for (size_t frame = 0; frame <= kRenderPassRetireAge + 1; ++frame)
+    {
+        drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+        swapBuffers();
+    }
+    EXPECT_LE(getPerfCounters().renderPassCacheSize, kMaxCachedRenderPasses);
+}
+
 // Test calling glTexParameteri(GL_TEXTURE_SWIZZLE_*) on a texture that attached to FBO with the
 // same value did not cause VkFramebuffer cache explode
 TEST_P(VulkanPerformanceCounterTest, SetTextureSwizzleWithSameValueOnFBOAttachedTexture)
@@ -7836,6 +7949,46 @@ TEST_P(VulkanPerformanceCounterTest, CreateDestroyTextureDoesNotIncreaseDescript
     EXPECT_EQ(0, textureDescriptorSetCacheTotalSizeIncrease);
 }
 
+// Tests that descriptor sets cached for textures that are still alive but no longer drawn with are
+// trimmed from the cache after a number of frames, even though allocation never runs out of space.
+TEST_P(VulkanPerformanceCounterTest, StaleTextureDescriptorSetsAreTrimmed)
+{
+    ANGLE_GL_PROGRAM(textureProgram, essl1_shaders::vs::Texture2D(),
+                     essl1_shaders::fs::Texture2D());
+
+    // Draw with many textures to populate the cache with one descriptorSet per texture.
+    const GLColor kColor           = GLColor::green;
+    constexpr size_t kTextureCount = 32;
+    GLTexture textures[kTextureCount];
+    for (size_t i = 0; i < kTextureCount; i++)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &kColor);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        drawQuad(textureProgram, std::string(essl1_shaders::PositionAttrib()), 0.0f);
+    }
+    EXPECT_PIXEL_COLOR_EQ(0, 0, kColor);
+    swapBuffers();
+    ASSERT_GL_NO_ERROR();
+
+    GLint textureDescriptorSetCacheTotalSizeBefore =
+        getPerfCounters().textureDescriptorSetCacheTotalSize;
+
+    // Keep drawing with only one of the textures for a while.
+    constexpr size_t kFrameCount = 64;
+    for (size_t frame = 0; frame < kFrameCount; frame++)
+    {
+        drawQuad(textureProgram, std::string(essl1_shaders::PositionAttrib()), 0.0f);
+        swapBuffers();
+    }
+    ASSERT_GL_NO_ERROR();
+
+    // The descriptorSets of the other textures are expected to have been evicted.
+    EXPECT_LT(getPerfCounters().textureDescriptorSetCacheTotalSize,
+              textureDescriptorSetCacheTotalSizeBefore);
+}
+
 // Similar to CreateDestroyTextureDoesNotIncreaseDescriptporSetCache, but for shader image.
 TEST_P(VulkanPerformanceCounterTest_ES31,
        CreateDestroyTextureDoesNotIncreaseComputeShaderDescriptporSetCache)
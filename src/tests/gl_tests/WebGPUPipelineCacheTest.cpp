@@ -0,0 +1,224 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// WebGPUPipelineCacheTest:
+//   Tests the eviction and the warm up list of the WebGPU back-end's render pipeline cache.
+//
+
+#include <array>
+#include <map>
+#include <vector>
+
+#include "libANGLE/Context.h"
+#include "libANGLE/Display.h"
+#include "libANGLE/renderer/wgpu/ProgramExecutableWgpu.h"
+#include "libANGLE/renderer/wgpu/wgpu_pipeline_state.h"
+#include "libANGLE/renderer/wgpu/wgpu_utils.h"
+#include "test_utils/ANGLETest.h"
+#include "test_utils/angle_test_instantiate.h"
+#include "test_utils/gl_raii.h"
+#include "util/EGLWindow.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr char kEGLExtName[] = "EGL_ANDROID_blob_cache";
+
+std::map<std::vector<uint8_t>, std::vector<uint8_t>> gApplicationCache;
+
+void SetBlob(const void *key, EGLsizeiANDROID keySize, const void *value, EGLsizeiANDROID valueSize)
+{
+    std::vector<uint8_t> keyVec(keySize);
+    memcpy(keyVec.data(), key, keySize);
+
+    std::vector<uint8_t> valueVec(valueSize);
+    memcpy(valueVec.data(), value, valueSize);
+
+    gApplicationCache[keyVec] = valueVec;
+}
+
+EGLsizeiANDROID GetBlob(const void *key,
+                        EGLsizeiANDROID keySize,
+                        void *value,
+                        EGLsizeiANDROID valueSize)
+{
+    std::vector<uint8_t> keyVec(keySize);
+    memcpy(keyVec.data(), key, keySize);
+
+    auto entry = gApplicationCache.find(keyVec);
+    if (entry == gApplicationCache.end())
+    {
+        return 0;
+    }
+
+    if (entry->second.size() <= static_cast<size_t>(valueSize))
+    {
+        memcpy(value, entry->second.data(), entry->second.size());
+    }
+
+    return entry->second.size();
+}
+
+// Every color mask results in a different render pipeline.
+constexpr std::array<std::array<GLboolean, 4>, 5> kColorMasks = {{
+    {GL_TRUE, GL_FALSE, GL_FALSE, GL_FALSE},
+    {GL_FALSE, GL_TRUE, GL_FALSE, GL_FALSE},
+    {GL_FALSE, GL_FALSE, GL_TRUE, GL_FALSE},
+    {GL_FALSE, GL_FALSE, GL_FALSE, GL_TRUE},
+    {GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE},
+}};
+
+class WebGPUPipelineCacheTest : public ANGLETest<>
+{
+  protected:
+    WebGPUPipelineCacheTest()
+    {
+        setWindowWidth(16);
+        setWindowHeight(16);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+
+        // The blob cache functions can only be set once per display.
+        forceNewDisplay();
+    }
+
+    void testTearDown() override { gApplicationCache.clear(); }
+
+    gl::Context *hackContext() const
+    {
+        egl::Display *display   = static_cast<egl::Display *>(getEGLWindow()->getDisplay());
+        gl::ContextID contextID = {
+            static_cast<GLuint>(reinterpret_cast<uintptr_t>(getEGLWindow()->getContext()))};
+        return display->getContext(contextID);
+    }
+
+    // Returns the pipeline cache of the program in use.
+    rx::webgpu::PipelineCache &hackPipelineCache() const
+    {
+        // Hack the angle!
+        const gl::ProgramExecutable *executable = hackContext()->getState().getProgramExecutable();
+        return rx::webgpu::GetImpl(executable)->getPipelineCache();
+    }
+
+    // Draws with kColorMasks[maskIndex] and returns the desc of the render pipeline that was used,
+    // which is the most recently used one of the cache.
+    rx::webgpu::RenderPipelineDesc drawWithColorMask(GLuint program, size_t maskIndex)
+    {
+        const std::array<GLboolean, 4> &mask = kColorMasks[maskIndex];
+        glColorMask(mask[0], mask[1], mask[2], mask[3]);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_GL_NO_ERROR();
+
+        std::vector<rx::webgpu::RenderPipelineDesc> descs;
+        hackPipelineCache().getWarmUpList(&descs);
+        EXPECT_FALSE(descs.empty());
+        return descs.empty() ? rx::webgpu::RenderPipelineDesc() : descs.front();
+    }
+};
+
+// Tests that once the cache is full, the least recently used pipeline is evicted.
+TEST_P(WebGPUPipelineCacheTest, EvictsLeastRecentlyUsed)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    glUseProgram(program);
+
+    rx::webgpu::PipelineCache &cache = hackPipelineCache();
+    cache.setCacheSizeForTesting(4);
+
+    std::array<rx::webgpu::RenderPipelineDesc, kColorMasks.size()> descs;
+    for (size_t maskIndex = 0; maskIndex < 4; ++maskIndex)
+    {
+        descs[maskIndex] = drawWithColorMask(program, maskIndex);
+    }
+    EXPECT_EQ(cache.size(), 4u);
+    EXPECT_EQ(cache.getCreateCountForTesting(), 4u);
+
+    // Using the first pipeline again makes the second one the least recently used.
+    drawWithColorMask(program, 0);
+    EXPECT_EQ(cache.getCreateCountForTesting(), 4u);
+
+    // A new pipeline evicts the second one.
+    descs[4] = drawWithColorMask(program, 4);
+    EXPECT_EQ(cache.size(), 4u);
+    EXPECT_EQ(cache.getCreateCountForTesting(), 5u);
+
+    std::vector<rx::webgpu::RenderPipelineDesc> cached;
+    cache.getWarmUpList(&cached);
+    ASSERT_EQ(cached.size(), 4u);
+    EXPECT_EQ(cached[0], descs[4]);
+    EXPECT_EQ(cached[1], descs[0]);
+    EXPECT_EQ(cached[2], descs[3]);
+    EXPECT_EQ(cached[3], descs[2]);
+
+    // The evicted pipeline is created again, and evicts the third one.
+    drawWithColorMask(program, 1);
+    EXPECT_EQ(cache.getCreateCountForTesting(), 6u);
+
+    cache.getWarmUpList(&cached);
+    ASSERT_EQ(cached.size(), 4u);
+    EXPECT_EQ(cached[0], descs[1]);
+    EXPECT_EQ(cached[1], descs[4]);
+    EXPECT_EQ(cached[2], descs[0]);
+    EXPECT_EQ(cached[3], descs[3]);
+}
+
+// Tests that the pipelines used by a program are created in the background for the next program
+// with the same shaders, and that its draws use them instead of creating new pipelines.
+TEST_P(WebGPUPipelineCacheTest, WarmUpFromBlobCache)
+{
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    ANGLE_SKIP_TEST_IF(!IsEGLDisplayExtensionEnabled(display, kEGLExtName));
+    eglSetBlobCacheFuncsANDROID(display, SetBlob, GetBlob);
+    ASSERT_EGL_SUCCESS();
+
+    std::vector<rx::webgpu::RenderPipelineDesc> usedDescs;
+    {
+        ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+        glUseProgram(program);
+
+        drawWithColorMask(program, 0);
+        drawWithColorMask(program, 1);
+        EXPECT_EQ(hackPipelineCache().getCreateCountForTesting(), 2u);
+        EXPECT_EQ(hackPipelineCache().getAsyncCreateCountForTesting(), 0u);
+        hackPipelineCache().getWarmUpList(&usedDescs);
+        ASSERT_EQ(usedDescs.size(), 2u);
+
+        // The warm up list is stored when the program is destroyed.
+        glUseProgram(0);
+    }
+    ASSERT_GL_NO_ERROR();
+    EXPECT_FALSE(gApplicationCache.empty());
+
+    // Program caching is disabled, so this program is linked again instead of being loaded from the
+    // binary that the first one left in the blob cache.
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    glUseProgram(program);
+
+    // The first draw starts creating both pipelines of the list and waits for the one it needs.
+    drawWithColorMask(program, 0);
+    rx::webgpu::PipelineCache &cache = hackPipelineCache();
+    EXPECT_EQ(cache.getAsyncCreateCountForTesting(), 2u);
+    EXPECT_EQ(cache.getCreateCountForTesting(), 0u);
+
+    // The second pipeline is served from the warm up as well.
+    drawWithColorMask(program, 1);
+    drawWithColorMask(program, 0);
+    EXPECT_EQ(cache.getAsyncCreateCountForTesting(), 2u);
+    EXPECT_EQ(cache.getCreateCountForTesting(), 0u);
+
+    std::vector<rx::webgpu::RenderPipelineDesc> warmedUpDescs;
+    cache.getWarmUpList(&warmedUpDescs);
+    ASSERT_EQ(warmedUpDescs.size(), 2u);
+    EXPECT_EQ(warmedUpDescs[0], usedDescs[1]);
+    EXPECT_EQ(warmedUpDescs[1], usedDescs[0]);
+}
+
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(WebGPUPipelineCacheTest,
+                       ES2_WEBGPU().enable(Feature::DisableProgramCaching));
@@ -22,6 +22,11 @@ namespace
 {
 constexpr unsigned int kIterationsPerStep = 128;
 
+// Object count of applications that keep tens of thousands of buffers alive, well past the ids
+// that fit in the resource maps' flat arrays.
+constexpr size_t kLargeObjectCount                   = 50000;
+constexpr unsigned int kLargeObjectIterationsPerStep = 4;
+
 enum TestMode
 {
     VertexArray,
@@ -242,6 +247,16 @@ BindingsParams VulkanParams(AllocationStyle allocationStyle, TestMode testMode)
     return params;
 }
 
+BindingsParams VulkanLargeObjectCountParams(AllocationStyle allocationStyle)
+{
+    BindingsParams params;
+    params.eglParameters     = egl_platform::VULKAN_NULL();
+    params.allocationStyle   = allocationStyle;
+    params.numObjects        = kLargeObjectCount;
+    params.iterationsPerStep = kLargeObjectIterationsPerStep;
+    return params;
+}
+
 TEST_P(BindingsBenchmark, Run)
 {
     run();
@@ -255,6 +270,8 @@ ANGLE_INSTANTIATE_TEST(BindingsBenchmark,
                        OpenGLOrGLESParams(AT_INITIALIZATION),
                        VulkanParams(EVERY_ITERATION, TestMode::MultipleBindings),
                        VulkanParams(AT_INITIALIZATION, TestMode::MultipleBindings),
-                       VulkanParams(AT_INITIALIZATION, TestMode::VertexArray));
+                       VulkanParams(AT_INITIALIZATION, TestMode::VertexArray),
+                       VulkanLargeObjectCountParams(EVERY_ITERATION),
+                       VulkanLargeObjectCountParams(AT_INITIALIZATION));
 
 }  // namespace angle
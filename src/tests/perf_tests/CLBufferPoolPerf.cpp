@@ -0,0 +1,191 @@
+//
+// Copyright 2025 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CLBufferPoolPerf:
+//   Performance test for creating, using and releasing short-lived OpenCL buffers.  This is the
+//   pattern that the CL buffer pools of the Vulkan backend recycle memory for.  Set
+//   ANGLE_ENABLE_CL_BUFFER_POOL_STATS_LOGGING in CLContextVk.cpp to log the pool hit rate.
+//
+
+#include "ANGLEComputeTestCL.h"
+
+#include <angle_cl.h>
+
+#include <sstream>
+#include <vector>
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 4;
+
+struct CLBufferPoolParams final : public RenderTestParams
+{
+    CLBufferPoolParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+        isCL              = true;
+    }
+
+    std::string story() const override;
+
+    size_t bufferSize      = 4 * 1024;
+    size_t buffersPerBatch = 256;
+    // Whether each buffer is written through the queue, so it is held by a queue serial before
+    // being released.
+    bool writeBuffers = true;
+};
+
+std::ostream &operator<<(std::ostream &os, const CLBufferPoolParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string CLBufferPoolParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story() << "_" << bufferSize << "B_" << buffersPerBatch;
+    if (writeBuffers)
+    {
+        strstr << "_write";
+    }
+
+    return strstr.str();
+}
+
+class CLBufferPoolPerfBenchmark : public ANGLEComputeTestCL,
+                                  public ::testing::WithParamInterface<CLBufferPoolParams>
+{
+  public:
+    CLBufferPoolPerfBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  protected:
+    void TearDown() override;
+
+  private:
+    cl_context mContext     = nullptr;
+    cl_command_queue mQueue = nullptr;
+    uint64_t mAllocations   = 0;
+    std::vector<uint8_t> mData;
+    std::vector<cl_mem> mBuffers;
+};
+
+CLBufferPoolPerfBenchmark::CLBufferPoolPerfBenchmark()
+    : ANGLEComputeTestCL("CLBufferPool", GetParam(), "ns")
+{}
+
+void CLBufferPoolPerfBenchmark::initializeBenchmark()
+{
+    const CLBufferPoolParams &params = GetParam();
+
+    cl_platform_id platform = nullptr;
+    cl_device_id device     = nullptr;
+    if (clGetPlatformIDs(1, &platform, nullptr) != CL_SUCCESS ||
+        clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 1, &device, nullptr) != CL_SUCCESS)
+    {
+        skipTest("No CL device");
+        return;
+    }
+
+    cl_int error = CL_SUCCESS;
+    mContext     = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &error);
+    ASSERT_EQ(CL_SUCCESS, error);
+    mQueue = clCreateCommandQueue(mContext, device, 0, &error);
+    ASSERT_EQ(CL_SUCCESS, error);
+
+    mData.resize(params.bufferSize, 0x5A);
+    mBuffers.resize(params.buffersPerBatch, nullptr);
+}
+
+void CLBufferPoolPerfBenchmark::destroyBenchmark()
+{
+    if (mQueue)
+    {
+        clReleaseCommandQueue(mQueue);
+        mQueue = nullptr;
+    }
+    if (mContext)
+    {
+        clReleaseContext(mContext);
+        mContext = nullptr;
+    }
+}
+
+void CLBufferPoolPerfBenchmark::drawBenchmark()
+{
+    const CLBufferPoolParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        for (cl_mem &buffer : mBuffers)
+        {
+            cl_int error = CL_SUCCESS;
+            buffer =
+                clCreateBuffer(mContext, CL_MEM_READ_WRITE, params.bufferSize, nullptr, &error);
+            ASSERT_EQ(CL_SUCCESS, error);
+
+            if (params.writeBuffers)
+            {
+                ASSERT_EQ(CL_SUCCESS, clEnqueueWriteBuffer(mQueue, buffer, CL_FALSE, 0,
+                                                           params.bufferSize, mData.data(), 0,
+                                                           nullptr, nullptr));
+            }
+        }
+        mAllocations += mBuffers.size();
+
+        // Release the batch while the writes may still be in flight; the memory is only reused
+        // once the queue has finished with it.
+        for (cl_mem &buffer : mBuffers)
+        {
+            clReleaseMemObject(buffer);
+            buffer = nullptr;
+        }
+        clFlush(mQueue);
+    }
+
+    clFinish(mQueue);
+}
+
+void CLBufferPoolPerfBenchmark::TearDown()
+{
+    if (!mSkipTest)
+    {
+        destroyBenchmark();
+    }
+    ANGLEPerfTest::TearDown();
+
+    if (mTotalNumStepsPerformed > 0)
+    {
+        recordIntegerMetric(".allocations",
+                            static_cast<size_t>(mAllocations / mTotalNumStepsPerformed), "count");
+    }
+}
+
+CLBufferPoolParams CLBufferPoolVulkanParams(size_t bufferSize, bool writeBuffers)
+{
+    CLBufferPoolParams params;
+    params.eglParameters = angle::egl_platform::VULKAN();
+    params.bufferSize    = bufferSize;
+    params.writeBuffers  = writeBuffers;
+    return params;
+}
+
+TEST_P(CLBufferPoolPerfBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(CLBufferPoolPerfBenchmark,
+                       CLBufferPoolVulkanParams(256, false),
+                       CLBufferPoolVulkanParams(4 * 1024, true),
+                       CLBufferPoolVulkanParams(64 * 1024, true),
+                       CLBufferPoolVulkanParams(1024 * 1024, true));
+
+}  // anonymous namespace
@@ -7,15 +7,24 @@
 //   Performance test for the shader translator. The test initializes the compiler once and then
 //   compiles the same shader repeatedly. There are different variations of the tests using
 //   different shaders.
+// PreprocessorPerfTest:
+//   Runs only the preprocessor over a generated shader that makes heavy use of macros.
 //
 
 #include "ANGLEPerfTest.h"
 
 #include "GLSLANG/ShaderLang.h"
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/DirectiveHandlerBase.h"
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/PoolAlloc.h"
 
+#include <algorithm>
+#include <sstream>
+
 namespace
 {
 
@@ -162,6 +171,128 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// This shader has many numeric literals that survive constant folding, so most of the translated
+// output is numbers written by the output pass.
+const char *kConstantHeavyESSL300FragSource = R"(#version 300 es
+precision highp float;
+precision highp int;
+
+uniform sampler2D uTex;
+uniform int uIndex;
+in vec2 vTexCoord;
+out vec4 my_FragColor;
+
+const float kWeights[32] = float[32](
+    0.0019, 0.0026, 0.0035, 0.0047, 0.0062, 0.0080, 0.0103, 0.0130,
+    0.0162, 0.0198, 0.0238, 0.0282, 0.0328, 0.0375, 0.0421, 0.0464,
+    0.0464, 0.0421, 0.0375, 0.0328, 0.0282, 0.0238, 0.0198, 0.0162,
+    0.0130, 0.0103, 0.0080, 0.0062, 0.0047, 0.0035, 0.0026, 0.0019);
+const vec2 kOffsets[16] = vec2[16](
+    vec2(-1.5, -1.5), vec2(-0.5, -1.5), vec2(0.5, -1.5), vec2(1.5, -1.5),
+    vec2(-1.5, -0.5), vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(1.5, -0.5),
+    vec2(-1.5, 0.5), vec2(-0.5, 0.5), vec2(0.5, 0.5), vec2(1.5, 0.5),
+    vec2(-1.5, 1.5), vec2(-0.5, 1.5), vec2(0.5, 1.5), vec2(1.5, 1.5));
+const ivec4 kSwizzles[8] = ivec4[8](
+    ivec4(0, 1, 2, 3), ivec4(1, 2, 3, 0), ivec4(2, 3, 0, 1), ivec4(3, 0, 1, 2),
+    ivec4(3, 2, 1, 0), ivec4(2, 1, 0, 3), ivec4(1, 0, 3, 2), ivec4(0, 3, 2, 1));
+const mat4 kColorMatrix = mat4(0.393, 0.349, 0.272, 0.0,
+                               0.769, 0.686, 0.534, 0.0,
+                               0.189, 0.168, 0.131, 0.0,
+                               0.0, 0.0, 0.0, 1.0);
+
+void main()
+{
+    vec4 sum = vec4(0.0);
+    for (int i = 0; i < 32; ++i)
+    {
+        vec2 offset = kOffsets[(i + uIndex) % 16] * 0.00390625;
+        sum += texture(uTex, vTexCoord + offset * float(i - 16)) * kWeights[i];
+    }
+    ivec4 swizzle = kSwizzles[uIndex % 8];
+    vec4 swizzled = vec4(sum[swizzle.x], sum[swizzle.y], sum[swizzle.z], sum[swizzle.w]);
+    my_FragColor = kColorMatrix * swizzled * 1.25 + vec4(0.015625, 0.03125, 0.0625, 0.0);
+})";
+
+const char *kConstantHeavyESSL300Id = "ConstantHeavyESSL300";
+
+// Generates a shader split into many large helper functions, each with its own locals, loops and
+// branches, the way compute-style kernels are often written.  Each function calls the previous
+// one so none of them is pruned.
+std::string GenerateManyFunctionsShader(int functionCount)
+{
+    std::stringstream source;
+    source << "#version 300 es\n";
+    source << "precision highp float;\n";
+    source << "uniform vec4 uParams[4];\n";
+    source << "uniform int uCount;\n";
+    source << "out vec4 my_FragColor;\n";
+    for (int i = 0; i < functionCount; ++i)
+    {
+        source << "vec4 stage" << i << "(vec4 x, int n)\n{\n";
+        if (i == 0)
+        {
+            source << "    vec4 acc = x;\n";
+        }
+        else
+        {
+            source << "    vec4 acc = stage" << (i - 1) << "(x, n);\n";
+        }
+        source << "    for (int j = 0; j < n; ++j)\n    {\n";
+        source << "        if ((j & " << (i % 3 + 1) << ") == 0)\n        {\n";
+        source << "            acc = acc * uParams[" << (i % 4) << "] + vec4(float(j));\n";
+        source << "        }\n        else\n        {\n";
+        source << "            acc = sin(acc) + uParams[" << ((i + 1) % 4) << "].xxyy;\n";
+        source << "        }\n    }\n";
+        source << "    mat2 m = mat2(acc.xy, acc.zw);\n";
+        source << "    acc.xy = m * acc.yx;\n";
+        source << "    acc.zw = clamp(acc.zw, vec2(-1.0), vec2(1.0));\n";
+        source << "    return acc;\n}\n";
+    }
+    source << "void main()\n{\n";
+    source << "    my_FragColor = stage" << (functionCount - 1) << "(uParams[0], uCount);\n";
+    source << "}\n";
+    return source.str();
+}
+
+const char *GetManyFunctionsESSL300FragSource()
+{
+    static const std::string source = GenerateManyFunctionsShader(64);
+    return source.c_str();
+}
+
+const char *kManyFunctionsESSL300Id = "ManyFunctionsESSL300";
+
+// Generates a shader with a single large function body full of multi-declarator and uninitialized
+// local declarations, so that tree transformations queue many edits to the same block.
+std::string GenerateManyLocalsShader(int localCount)
+{
+    std::stringstream source;
+    source << "#version 300 es\n";
+    source << "precision highp float;\n";
+    source << "uniform vec4 uParams[4];\n";
+    source << "out vec4 my_FragColor;\n";
+    source << "void main()\n{\n";
+    source << "    vec4 acc = vec4(0);\n";
+    for (int i = 0; i < localCount; ++i)
+    {
+        source << "    vec4 a" << i << " = uParams[" << (i % 4) << "], b" << i << " = a" << i
+               << ".yzwx;\n";
+        source << "    float c" << i << ";\n";
+        source << "    acc += a" << i << " * b" << i << " + vec4(c" << i << ");\n";
+    }
+    source << "    my_FragColor = acc;\n";
+    source << "}\n";
+    return source.str();
+}
+
+const char *GetManyLocalsESSL300FragSource()
+{
+    static const std::string source = GenerateManyLocalsShader(1024);
+    return source.c_str();
+}
+
+const char *kManyLocalsESSL300Id = "ManyLocalsESSL300";
+
 constexpr int kNumIterationsPerStep = 4;
 
 struct CompilerParameters
@@ -180,6 +311,8 @@ struct CompilerParameters
                 return "GLSL_4_50";
             case SH_ESSL_OUTPUT:
                 return "ESSL";
+            case SH_SPIRV_VULKAN_OUTPUT:
+                return "SPIRV";
             default:
                 UNREACHABLE();
                 return "unk";
@@ -195,6 +328,7 @@ bool IsPlatformAvailable(const CompilerParameters &param)
     {
         case SH_HLSL_4_1_OUTPUT:
         case SH_HLSL_3_0_OUTPUT:
+        case SH_SPIRV_VULKAN_OUTPUT:
         {
             angle::PoolAllocator allocator;
             InitializePoolIndex();
@@ -256,6 +390,8 @@ class CompilerPerfTest : public ANGLEPerfTest,
 
   private:
     const char *mTestShader;
+    // Largest pool memory allocated by a single compilation.
+    size_t mPeakPoolAllocatedBytes = 0;
 
     ShBuiltInResources mResources;
     angle::PoolAllocator mAllocator;
@@ -264,7 +400,9 @@ class CompilerPerfTest : public ANGLEPerfTest,
 
 CompilerPerfTest::CompilerPerfTest()
     : ANGLEPerfTest("CompilerPerf", "", GetParam().testId, kNumIterationsPerStep)
-{}
+{
+    mReporter->RegisterImportantMetric(".peak_pool_memory", "sizeInBytes");
+}
 
 void CompilerPerfTest::SetUp()
 {
@@ -297,6 +435,8 @@ void CompilerPerfTest::TearDown()
     FreePoolIndex();
 
     ANGLEPerfTest::TearDown();
+
+    recordIntegerMetric(".peak_pool_memory", mPeakPoolAllocatedBytes, "sizeInBytes");
 }
 
 void CompilerPerfTest::step()
@@ -320,6 +460,8 @@ void CompilerPerfTest::step()
     for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
     {
         mTranslator->compile(shaderStrings, 1, compileOptions);
+        mPeakPoolAllocatedBytes =
+            std::max(mPeakPoolAllocatedBytes, mTranslator->getPoolAllocatedBytes());
     }
 }
 
@@ -343,6 +485,125 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT,
+                           kConstantHeavyESSL300FragSource,
+                           kConstantHeavyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           kConstantHeavyESSL300FragSource,
+                           kConstantHeavyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           kConstantHeavyESSL300FragSource,
+                           kConstantHeavyESSL300Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           GetManyFunctionsESSL300FragSource(),
+                           kManyFunctionsESSL300Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           GetManyFunctionsESSL300FragSource(),
+                           kManyFunctionsESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT,
+                           GetManyLocalsESSL300FragSource(),
+                           kManyLocalsESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           GetManyLocalsESSL300FragSource(),
+                           kManyLocalsESSL300Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           GetManyLocalsESSL300FragSource(),
+                           kManyLocalsESSL300Id));
+
+// Generates a shader in the style of a generated uber-shader: thousands of feature #defines,
+// function-like helper macros built on top of them, and #if blocks testing them.
+std::string GenerateMacroHeavyShader(int defineCount)
+{
+    std::stringstream source;
+    source << "precision highp float;\n";
+    for (int i = 0; i < defineCount; ++i)
+    {
+        source << "#define FEATURE_" << i << " " << (i % 3) << "\n";
+        source << "#define SCALE_" << i << "(x) ((x) * float(FEATURE_" << i << ") + 0.5)\n";
+    }
+    source << "#define ACCUMULATE(sum, x) sum = sum + (x)\n";
+    source << "void main()\n{\n    float sum = 0.0;\n";
+    for (int i = 0; i < defineCount; ++i)
+    {
+        source << "#if defined(FEATURE_" << i << ") && FEATURE_" << i << " > 0\n";
+        source << "    ACCUMULATE(sum, SCALE_" << i << "(sum));\n";
+        source << "#endif\n";
+    }
+    source << "    gl_FragColor = vec4(sum);\n}\n";
+    return source.str();
+}
+
+class NullDiagnostics : public angle::pp::Diagnostics
+{
+  public:
+    void print(ID id, const angle::pp::SourceLocation &loc, const std::string &text) override {}
+};
+
+class NullDirectiveHandler : public angle::pp::DirectiveHandler
+{
+  public:
+    void handleError(const angle::pp::SourceLocation &loc, const std::string &msg) override {}
+    void handlePragma(const angle::pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {}
+    void handleExtension(const angle::pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {}
+    void handleVersion(const angle::pp::SourceLocation &loc,
+                       int version,
+                       ShShaderSpec spec,
+                       angle::pp::MacroSet *macroSet) override
+    {}
+};
+
+class PreprocessorPerfTest : public ANGLEPerfTest
+{
+  public:
+    PreprocessorPerfTest();
+
+    void step() override;
+
+  private:
+    std::string mShaderSource;
+};
+
+PreprocessorPerfTest::PreprocessorPerfTest()
+    : ANGLEPerfTest("CompilerPerf", "", "MacroHeavy_preprocessor", kNumIterationsPerStep),
+      mShaderSource(GenerateMacroHeavyShader(2000))
+{}
+
+void PreprocessorPerfTest::step()
+{
+    const char *shaderStrings[] = {mShaderSource.c_str()};
+
+    NullDiagnostics diagnostics;
+    NullDirectiveHandler directiveHandler;
+
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        angle::pp::Preprocessor preprocessor(&diagnostics, &directiveHandler,
+                                             angle::pp::PreprocessorSettings(SH_WEBGL2_SPEC));
+        preprocessor.init(1, shaderStrings, nullptr);
+
+        angle::pp::Token token;
+        do
+        {
+            preprocessor.lex(&token);
+        } while (token.type != angle::pp::Token::LAST);
+    }
+}
+
+TEST_F(PreprocessorPerfTest, Run)
+{
+    run();
+}
 
 }  // anonymous namespace
@@ -29,12 +29,16 @@ enum class StateChange
     Scissor,
     ManyTextureDraw,
     Uniform,
+    VertexBufferOffset,
+    MultiDrawArrays,
+    MultiDrawElements,
     InvalidEnum,
     EnumCount = InvalidEnum,
 };
 
 constexpr size_t kCycleVBOPoolSize  = 200;
 constexpr size_t kManyTexturesCount = 8;
+constexpr GLsizei kMultiDrawCount   = 16;
 
 struct DrawArraysPerfParams : public DrawCallPerfParams
 {
@@ -81,6 +85,15 @@ std::string DrawArraysPerfParams::story() const
         case StateChange::Uniform:
             strstr << "_uniform";
             break;
+        case StateChange::VertexBufferOffset:
+            strstr << "_vbo_offset_change";
+            break;
+        case StateChange::MultiDrawArrays:
+            strstr << "_multi_draw_arrays";
+            break;
+        case StateChange::MultiDrawElements:
+            strstr << "_multi_draw_elements";
+            break;
         default:
             break;
     }
@@ -135,13 +148,15 @@ class DrawCallPerfBenchmark : public ANGLERenderTest,
     void drawBenchmark() override;
 
   private:
-    GLuint mProgram1   = 0;
-    GLuint mProgram2   = 0;
-    GLuint mProgram3   = 0;
-    GLuint mBuffer1    = 0;
-    GLuint mBuffer2    = 0;
-    GLuint mFBO        = 0;
-    GLuint mFBOTexture = 0;
+    GLuint mProgram1    = 0;
+    GLuint mProgram2    = 0;
+    GLuint mProgram3    = 0;
+    GLuint mBuffer1     = 0;
+    GLuint mBuffer2     = 0;
+    GLuint mBuffer3     = 0;
+    GLuint mIndexBuffer = 0;
+    GLuint mFBO         = 0;
+    GLuint mFBOTexture  = 0;
     std::vector<GLuint> mTextures;
     int mNumTris = GetParam().numTris;
     std::vector<GLuint> mVBOPool;
@@ -158,6 +173,12 @@ DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf",
     {
         skipTest("https://issuetracker.google.com/issues/298407224 Fails on Pixel 6 GLES");
     }
+
+    if (params.stateChange == StateChange::MultiDrawArrays ||
+        params.stateChange == StateChange::MultiDrawElements)
+    {
+        addExtensionPrerequisite("GL_ANGLE_multi_draw");
+    }
 }
 
 void DrawCallPerfBenchmark::initializeBenchmark()
@@ -277,6 +298,26 @@ void main()
     mBuffer1 = Create2DTriangleBuffer(mNumTris, GL_STATIC_DRAW);
     mBuffer2 = Create2DTriangleBuffer(mNumTris, GL_STATIC_DRAW);
 
+    if (params.stateChange == StateChange::VertexBufferOffset)
+    {
+        // One extra triangle so that the draw can be offset by a triangle into the buffer.
+        mBuffer3 = Create2DTriangleBuffer(mNumTris + 1, GL_STATIC_DRAW);
+    }
+
+    if (params.stateChange == StateChange::MultiDrawElements)
+    {
+        std::vector<GLushort> indices(3 * mNumTris);
+        for (size_t index = 0; index < indices.size(); ++index)
+        {
+            indices[index] = static_cast<GLushort>(index);
+        }
+
+        glGenBuffers(1, &mIndexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLushort), indices.data(),
+                     GL_STATIC_DRAW);
+    }
+
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
     glEnableVertexAttribArray(0);
 
@@ -342,6 +383,8 @@ void DrawCallPerfBenchmark::destroyBenchmark()
     glDeleteProgram(mProgram3);
     glDeleteBuffers(1, &mBuffer1);
     glDeleteBuffers(1, &mBuffer2);
+    glDeleteBuffers(1, &mBuffer3);
+    glDeleteBuffers(1, &mIndexBuffer);
     glDeleteTextures(1, &mFBOTexture);
     glDeleteTextures(mTextures.size(), mTextures.data());
     glDeleteFramebuffers(1, &mFBO);
@@ -443,6 +486,23 @@ void ChangeProgramThenDraw(unsigned int iterations,
     }
 }
 
+// Only changes the offset of the vertex buffer binding, which leaves the vertex input state intact.
+void ChangeVertexBufferOffsetThenDraw(unsigned int iterations, GLsizei numElements, GLuint buffer)
+{
+    constexpr size_t kTriangleSize = 3 * 2 * sizeof(GLfloat);
+
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    for (unsigned int it = 0; it < iterations; it++)
+    {
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+        glDrawArrays(GL_TRIANGLES, 0, numElements);
+
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0,
+                              reinterpret_cast<const void *>(kTriangleSize));
+        glDrawArrays(GL_TRIANGLES, 0, numElements);
+    }
+}
+
 void CycleVertexBufferThenDraw(unsigned int iterations,
                                GLsizei numElements,
                                const std::vector<GLuint> &vbos,
@@ -569,6 +629,31 @@ void UpdateUniformThenDraw(unsigned int iterations, GLsizei numElements)
     }
 }
 
+// Issues kMultiDrawCount draws with each call.  The draws share all state, so they can be batched
+// into a single backend draw.
+void DrawWithMultiDrawArrays(unsigned int iterations, GLsizei numElements)
+{
+    const std::vector<GLint> firsts(kMultiDrawCount, 0);
+    const std::vector<GLsizei> counts(kMultiDrawCount, numElements);
+
+    for (unsigned int it = 0; it < iterations; it++)
+    {
+        glMultiDrawArraysANGLE(GL_TRIANGLES, firsts.data(), counts.data(), kMultiDrawCount);
+    }
+}
+
+void DrawWithMultiDrawElements(unsigned int iterations, GLsizei numElements)
+{
+    const std::vector<GLsizei> counts(kMultiDrawCount, numElements);
+    const std::vector<const GLvoid *> offsets(kMultiDrawCount, nullptr);
+
+    for (unsigned int it = 0; it < iterations; it++)
+    {
+        glMultiDrawElementsANGLE(GL_TRIANGLES, counts.data(), GL_UNSIGNED_SHORT, offsets.data(),
+                                 kMultiDrawCount);
+    }
+}
+
 void DrawCallPerfBenchmark::drawBenchmark()
 {
     // This workaround fixes a huge queue of graphics commands accumulating on the GL
@@ -625,6 +710,15 @@ void DrawCallPerfBenchmark::drawBenchmark()
         case StateChange::Uniform:
             UpdateUniformThenDraw(params.iterationsPerStep, numElements);
             break;
+        case StateChange::VertexBufferOffset:
+            ChangeVertexBufferOffsetThenDraw(params.iterationsPerStep, numElements, mBuffer3);
+            break;
+        case StateChange::MultiDrawArrays:
+            DrawWithMultiDrawArrays(params.iterationsPerStep, numElements);
+            break;
+        case StateChange::MultiDrawElements:
+            DrawWithMultiDrawElements(params.iterationsPerStep, numElements);
+            break;
         case StateChange::InvalidEnum:
             ADD_FAILURE() << "Invalid state change.";
             break;
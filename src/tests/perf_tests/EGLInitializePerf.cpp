@@ -8,6 +8,7 @@
 //
 
 #include "ANGLEPerfTest.h"
+#include "common/system_utils.h"
 #include "platform/PlatformMethods.h"
 #include "test_utils/angle_test_configs.h"
 #include "test_utils/angle_test_instantiate.h"
@@ -72,6 +73,8 @@ class EGLInitializePerfTest : public ANGLEPerfTest,
     OSWindow *mOSWindow;
     EGLDisplay mDisplay;
     Captures mCaptures;
+    // Names of the features enabled on the display; must outlive the display.
+    std::vector<const char *> mEnabledFeatureOverrides;
 };
 
 EGLInitializePerfTest::EGLInitializePerfTest()
@@ -79,7 +82,7 @@ EGLInitializePerfTest::EGLInitializePerfTest()
 {
     auto platform = GetParam().eglParameters;
 
-    std::vector<EGLint> displayAttributes;
+    std::vector<EGLAttrib> displayAttributes;
     displayAttributes.push_back(EGL_PLATFORM_ANGLE_TYPE_ANGLE);
     displayAttributes.push_back(platform.renderer);
     displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MAJOR_ANGLE);
@@ -93,22 +96,33 @@ EGLInitializePerfTest::EGLInitializePerfTest()
         displayAttributes.push_back(EGL_PLATFORM_ANGLE_DEVICE_TYPE_ANGLE);
         displayAttributes.push_back(platform.deviceType);
     }
+
+    for (angle::Feature feature : platform.enabledFeatureOverrides)
+    {
+        mEnabledFeatureOverrides.push_back(angle::GetFeatureName(feature));
+
+        // The device capability snapshot is only used if a directory is given for it.
+        if (feature == angle::Feature::UseDeviceCapabilitySnapshot &&
+            angle::GetEnvironmentVar("ANGLE_DEVICE_CAPABILITY_SNAPSHOT_DIR").empty())
+        {
+            angle::SetEnvironmentVar("ANGLE_DEVICE_CAPABILITY_SNAPSHOT_DIR",
+                                     angle::GetExecutableDirectory().c_str());
+        }
+    }
+    if (!mEnabledFeatureOverrides.empty())
+    {
+        mEnabledFeatureOverrides.push_back(nullptr);
+        displayAttributes.push_back(EGL_FEATURE_OVERRIDES_ENABLED_ANGLE);
+        displayAttributes.push_back(reinterpret_cast<EGLAttrib>(mEnabledFeatureOverrides.data()));
+    }
     displayAttributes.push_back(EGL_NONE);
 
     mOSWindow = OSWindow::New();
     mOSWindow->initialize("EGLInitialize Test", 64, 64);
 
-    auto eglGetPlatformDisplayEXT = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
-        eglGetProcAddress("eglGetPlatformDisplayEXT"));
-    if (eglGetPlatformDisplayEXT == nullptr)
-    {
-        std::cerr << "Error getting platform display!" << std::endl;
-        return;
-    }
-
-    mDisplay = eglGetPlatformDisplayEXT(EGL_PLATFORM_ANGLE_ANGLE,
-                                        reinterpret_cast<void *>(mOSWindow->getNativeDisplay()),
-                                        &displayAttributes[0]);
+    mDisplay = eglGetPlatformDisplay(EGL_PLATFORM_ANGLE_ANGLE,
+                                     reinterpret_cast<void *>(mOSWindow->getNativeDisplay()),
+                                     &displayAttributes[0]);
 }
 
 void EGLInitializePerfTest::SetUp()
@@ -160,6 +174,7 @@ TEST_P(EGLInitializePerfTest, Run)
 ANGLE_INSTANTIATE_TEST(EGLInitializePerfTest,
                        angle::ES2_D3D11(),
                        angle::ES2_METAL(),
-                       angle::ES2_VULKAN());
+                       angle::ES2_VULKAN(),
+                       angle::ES2_VULKAN().enable(angle::Feature::UseDeviceCapabilitySnapshot));
 
 }  // namespace
@@ -0,0 +1,353 @@
+//
+// Copyright 2025 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EntryPointPerf:
+//   Performance test for the front-end overhead of the hottest GL entry points, which is mostly
+//   parameter unpacking and validation.  Every test repeatedly calls a single valid entry point on
+//   a null device, so that the backend does as little work as possible.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <array>
+#include <sstream>
+
+#include "test_utils/angle_test_instantiate.h"
+#include "util/shader_utils.h"
+
+namespace angle
+{
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 1024;
+
+enum class EntryPointUnderTest
+{
+    ActiveTexture,
+    BindBuffer,
+    BindTexture,
+    DrawArrays,
+    DrawElements,
+    EnableVertexAttribArray,
+    Uniform1f,
+    Uniform1i,
+    Uniform4fv,
+    UniformMatrix4fv,
+    UseProgram,
+    VertexAttribPointer,
+};
+
+const char *GetEntryPointUnderTestName(EntryPointUnderTest entryPoint)
+{
+    switch (entryPoint)
+    {
+        case EntryPointUnderTest::ActiveTexture:
+            return "active_texture";
+        case EntryPointUnderTest::BindBuffer:
+            return "bind_buffer";
+        case EntryPointUnderTest::BindTexture:
+            return "bind_texture";
+        case EntryPointUnderTest::DrawArrays:
+            return "draw_arrays";
+        case EntryPointUnderTest::DrawElements:
+            return "draw_elements";
+        case EntryPointUnderTest::EnableVertexAttribArray:
+            return "enable_vertex_attrib_array";
+        case EntryPointUnderTest::Uniform1f:
+            return "uniform1f";
+        case EntryPointUnderTest::Uniform1i:
+            return "uniform1i";
+        case EntryPointUnderTest::Uniform4fv:
+            return "uniform4fv";
+        case EntryPointUnderTest::UniformMatrix4fv:
+            return "uniform_matrix4fv";
+        case EntryPointUnderTest::UseProgram:
+            return "use_program";
+        case EntryPointUnderTest::VertexAttribPointer:
+            return "vertex_attrib_pointer";
+        default:
+            UNREACHABLE();
+            return "";
+    }
+}
+
+struct EntryPointParams final : public RenderTestParams
+{
+    EntryPointParams()
+    {
+        majorVersion      = 2;
+        minorVersion      = 0;
+        windowWidth       = 64;
+        windowHeight      = 64;
+        iterationsPerStep = kIterationsPerStep;
+    }
+
+    std::string story() const override;
+
+    EntryPointUnderTest entryPoint = EntryPointUnderTest::Uniform4fv;
+};
+
+std::ostream &operator<<(std::ostream &os, const EntryPointParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string EntryPointParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story() << "_" << GetEntryPointUnderTestName(entryPoint);
+
+    return strstr.str();
+}
+
+class EntryPointBenchmark : public ANGLERenderTest,
+                            public ::testing::WithParamInterface<EntryPointParams>
+{
+  public:
+    EntryPointBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    // Two of each object, so that consecutive calls do not bind the same one again.
+    std::array<GLuint, 2> mPrograms = {};
+    std::array<GLuint, 2> mBuffers  = {};
+    std::array<GLuint, 2> mTextures = {};
+    GLuint mIndexBuffer             = 0;
+
+    GLint mMatrixLocation  = -1;
+    GLint mVectorLocation  = -1;
+    GLint mScaleLocation   = -1;
+    GLint mIndexLocation   = -1;
+    GLint mMaxTextureUnits = 0;
+};
+
+EntryPointBenchmark::EntryPointBenchmark() : ANGLERenderTest("EntryPoint", GetParam()) {}
+
+void EntryPointBenchmark::initializeBenchmark()
+{
+    constexpr char kVS[] = R"(attribute vec4 a_position;
+uniform mat4 u_matrix;
+uniform vec4 u_vector;
+uniform float u_scale;
+void main()
+{
+    gl_Position = u_matrix * a_position * u_scale + u_vector;
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+uniform int u_index;
+void main()
+{
+    gl_FragColor = vec4(float(u_index));
+})";
+
+    for (GLuint &program : mPrograms)
+    {
+        program = CompileProgram(kVS, kFS);
+        ASSERT_NE(0u, program);
+        glBindAttribLocation(program, 0, "a_position");
+        glLinkProgram(program);
+    }
+
+    glUseProgram(mPrograms[0]);
+    mMatrixLocation = glGetUniformLocation(mPrograms[0], "u_matrix");
+    mVectorLocation = glGetUniformLocation(mPrograms[0], "u_vector");
+    mScaleLocation  = glGetUniformLocation(mPrograms[0], "u_scale");
+    mIndexLocation  = glGetUniformLocation(mPrograms[0], "u_index");
+    ASSERT_NE(-1, mMatrixLocation);
+    ASSERT_NE(-1, mVectorLocation);
+    ASSERT_NE(-1, mScaleLocation);
+    ASSERT_NE(-1, mIndexLocation);
+
+    constexpr std::array<GLfloat, 6> kTriangle = {-1.0f, -1.0f, 1.0f, -1.0f, 0.0f, 1.0f};
+    glGenBuffers(static_cast<GLsizei>(mBuffers.size()), mBuffers.data());
+    for (GLuint buffer : mBuffers)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(kTriangle), kTriangle.data(), GL_STATIC_DRAW);
+    }
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(0);
+
+    constexpr std::array<GLushort, 3> kIndices = {0, 1, 2};
+    glGenBuffers(1, &mIndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(kIndices), kIndices.data(), GL_STATIC_DRAW);
+
+    glGenTextures(static_cast<GLsizei>(mTextures.size()), mTextures.data());
+    for (GLuint texture : mTextures)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    }
+
+    glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &mMaxTextureUnits);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void EntryPointBenchmark::destroyBenchmark()
+{
+    for (GLuint program : mPrograms)
+    {
+        glDeleteProgram(program);
+    }
+    glDeleteBuffers(static_cast<GLsizei>(mBuffers.size()), mBuffers.data());
+    glDeleteBuffers(1, &mIndexBuffer);
+    glDeleteTextures(static_cast<GLsizei>(mTextures.size()), mTextures.data());
+}
+
+void EntryPointBenchmark::drawBenchmark()
+{
+    const EntryPointParams &params = GetParam();
+
+    constexpr std::array<GLfloat, 16> kMatrix = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+                                                 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+    constexpr std::array<GLfloat, 4> kVector  = {0.0f, 0.0f, 0.0f, 0.0f};
+
+    // Each case keeps the loop tight so that the measurement is dominated by the entry point.
+    switch (params.entryPoint)
+    {
+        case EntryPointUnderTest::ActiveTexture:
+            for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+            {
+                glActiveTexture(GL_TEXTURE0 + (it % mMaxTextureUnits));
+            }
+            glActiveTexture(GL_TEXTURE0);
+            break;
+        case EntryPointUnderTest::BindBuffer:
+            for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, mBuffers[it & 1]);
+            }
+            break;
+        case EntryPointUnderTest::BindTexture:
+            for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+            {
+                glBindTexture(GL_TEXTURE_2D, mTextures[it & 1]);
+            }
+            break;
+        case EntryPointUnderTest::DrawArrays:
+            for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+            {
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+            }
+            break;
+        case EntryPointUnderTest::DrawElements:
+            for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+            {
+                glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, nullptr);
+            }
+            break;
+        case EntryPointUnderTest::EnableVertexAttribArray:
+            for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+            {
+                glEnableVertexAttribArray(1);
+                glDisableVertexAttribArray(1);
+            }
+            break;
+        case EntryPointUnderTest::Uniform1f:
+            for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+            {
+                glUniform1f(mScaleLocation, static_cast<GLfloat>(it & 1));
+            }
+            break;
+        case EntryPointUnderTest::Uniform1i:
+            for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+            {
+                glUniform1i(mIndexLocation, static_cast<GLint>(it & 1));
+            }
+            break;
+        case EntryPointUnderTest::Uniform4fv:
+            for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+            {
+                glUniform4fv(mVectorLocation, 1, kVector.data());
+            }
+            break;
+        case EntryPointUnderTest::UniformMatrix4fv:
+            for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+            {
+                glUniformMatrix4fv(mMatrixLocation, 1, GL_FALSE, kMatrix.data());
+            }
+            break;
+        case EntryPointUnderTest::UseProgram:
+            for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+            {
+                glUseProgram(mPrograms[it & 1]);
+            }
+            glUseProgram(mPrograms[0]);
+            break;
+        case EntryPointUnderTest::VertexAttribPointer:
+            for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+            {
+                glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0,
+                                      reinterpret_cast<const void *>((it & 1) * sizeof(GLfloat)));
+            }
+            glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+EntryPointParams VulkanNullParams(EntryPointUnderTest entryPoint)
+{
+    EntryPointParams params;
+    params.eglParameters = egl_platform::VULKAN_NULL();
+    params.entryPoint    = entryPoint;
+    return params;
+}
+
+EntryPointParams OpenGLOrGLESNullParams(EntryPointUnderTest entryPoint)
+{
+    EntryPointParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES_NULL();
+    params.entryPoint    = entryPoint;
+    return params;
+}
+
+EntryPointParams D3D11NullParams(EntryPointUnderTest entryPoint)
+{
+    EntryPointParams params;
+    params.eglParameters = egl_platform::D3D11_NULL();
+    params.entryPoint    = entryPoint;
+    return params;
+}
+
+TEST_P(EntryPointBenchmark, Run)
+{
+    run();
+}
+
+// Per entry point, on the Vulkan null device, which is the primary configuration.  The other null
+// devices cover the most common uniform and draw calls.
+ANGLE_INSTANTIATE_TEST(EntryPointBenchmark,
+                       VulkanNullParams(EntryPointUnderTest::ActiveTexture),
+                       VulkanNullParams(EntryPointUnderTest::BindBuffer),
+                       VulkanNullParams(EntryPointUnderTest::BindTexture),
+                       VulkanNullParams(EntryPointUnderTest::DrawArrays),
+                       VulkanNullParams(EntryPointUnderTest::DrawElements),
+                       VulkanNullParams(EntryPointUnderTest::EnableVertexAttribArray),
+                       VulkanNullParams(EntryPointUnderTest::Uniform1f),
+                       VulkanNullParams(EntryPointUnderTest::Uniform1i),
+                       VulkanNullParams(EntryPointUnderTest::Uniform4fv),
+                       VulkanNullParams(EntryPointUnderTest::UniformMatrix4fv),
+                       VulkanNullParams(EntryPointUnderTest::UseProgram),
+                       VulkanNullParams(EntryPointUnderTest::VertexAttribPointer),
+                       OpenGLOrGLESNullParams(EntryPointUnderTest::Uniform4fv),
+                       OpenGLOrGLESNullParams(EntryPointUnderTest::DrawArrays),
+                       D3D11NullParams(EntryPointUnderTest::Uniform4fv),
+                       D3D11NullParams(EntryPointUnderTest::DrawArrays));
+
+}  // anonymous namespace
+}  // namespace angle
@@ -0,0 +1,173 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GLES1StateChangesPerf:
+//   Performance test for GLES1 content that cycles through many fixed-function state combinations.
+//   Every new combination needs a GLES1 emulation program specialized for it, which is either
+//   linked at draw time or in the background.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 64;
+
+// Enables toggled on and off between draws; every combination is used.
+constexpr GLenum kToggledStates[] = {
+    GL_LIGHTING, GL_FOG, GL_ALPHA_TEST, GL_TEXTURE_2D, GL_COLOR_MATERIAL, GL_NORMALIZE,
+};
+constexpr GLenum kTexEnvModes[] = {GL_MODULATE, GL_DECAL, GL_BLEND, GL_ADD, GL_REPLACE};
+constexpr GLenum kFogModes[]    = {GL_LINEAR, GL_EXP, GL_EXP2};
+
+constexpr size_t kCombinationCount =
+    (1u << std::size(kToggledStates)) * std::size(kTexEnvModes) * std::size(kFogModes);
+
+struct GLES1StateChangesParams final : public RenderTestParams
+{
+    GLES1StateChangesParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+        majorVersion      = 1;
+        minorVersion      = 0;
+        windowWidth       = 64;
+        windowHeight      = 64;
+    }
+
+    std::string story() const override;
+
+    bool specializeInBackground = false;
+};
+
+std::ostream &operator<<(std::ostream &os, const GLES1StateChangesParams &params)
+{
+    return os << params.backendAndStory().substr(1);
+}
+
+std::string GLES1StateChangesParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+
+    if (specializeInBackground)
+    {
+        strstr << "_background_specialization";
+    }
+
+    return strstr.str();
+}
+
+class GLES1StateChangesBenchmark : public ANGLERenderTest,
+                                   public ::testing::WithParamInterface<GLES1StateChangesParams>
+{
+  public:
+    GLES1StateChangesBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mTexture = 0;
+    // Index of the next state combination to draw with.
+    size_t mCombination = 0;
+};
+
+GLES1StateChangesBenchmark::GLES1StateChangesBenchmark()
+    : ANGLERenderTest("GLES1StateChanges", GetParam())
+{}
+
+void GLES1StateChangesBenchmark::initializeBenchmark()
+{
+    constexpr GLfloat kVertices[]  = {-1.0f, -1.0f, 0.0f, 3.0f, -1.0f, 0.0f, -1.0f, 3.0f, 0.0f};
+    constexpr GLfloat kTexCoords[] = {0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f};
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, kVertices);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glTexCoordPointer(2, GL_FLOAT, 0, kTexCoords);
+
+    const std::vector<GLubyte> pixels(4 * 4 * 4, 0x80);
+    glGenTextures(1, &mTexture);
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 4, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    glEnable(GL_LIGHT0);
+    glAlphaFunc(GL_GREATER, 0.25f);
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void GLES1StateChangesBenchmark::destroyBenchmark()
+{
+    glDeleteTextures(1, &mTexture);
+}
+
+void GLES1StateChangesBenchmark::drawBenchmark()
+{
+    const GLES1StateChangesParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        size_t combination = mCombination;
+        mCombination       = (mCombination + 1) % kCombinationCount;
+
+        for (GLenum state : kToggledStates)
+        {
+            if (combination % 2 != 0)
+            {
+                glEnable(state);
+            }
+            else
+            {
+                glDisable(state);
+            }
+            combination /= 2;
+        }
+
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE,
+                  kTexEnvModes[combination % std::size(kTexEnvModes)]);
+        combination /= std::size(kTexEnvModes);
+
+        glFogf(GL_FOG_MODE, static_cast<GLfloat>(kFogModes[combination % std::size(kFogModes)]));
+
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+GLES1StateChangesParams VulkanParams(bool specializeInBackground)
+{
+    GLES1StateChangesParams params;
+    params.eglParameters          = egl_platform::VULKAN();
+    params.specializeInBackground = specializeInBackground;
+    if (specializeInBackground)
+    {
+        params.eglParameters.enable(Feature::SpecializeGles1ProgramsInBackground);
+    }
+    return params;
+}
+
+}  // anonymous namespace
+
+TEST_P(GLES1StateChangesBenchmark, Run)
+{
+    run();
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(GLES1StateChangesBenchmark);
+ANGLE_INSTANTIATE_TEST(GLES1StateChangesBenchmark, VulkanParams(false), VulkanParams(true));
@@ -0,0 +1,241 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ProgramBinaryLoadPerf:
+//   Performance test for loading a large corpus of programs with glProgramBinary, the way
+//   applications restore their program cache at startup.  Only a few uniform locations are looked
+//   up on each program, as most shipped programs are never queried further.  The loaded programs
+//   are kept alive until the next step, so the process memory samples include all of them.  Also
+//   reports the process memory taken by each loaded program.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+#include <vector>
+
+#include "common/system_utils.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kProgramCount = 1000;
+
+struct ProgramBinaryLoadParams final : public RenderTestParams
+{
+    ProgramBinaryLoadParams()
+    {
+        iterationsPerStep = kProgramCount;
+        majorVersion      = 3;
+        minorVersion      = 0;
+        windowWidth       = 64;
+        windowHeight      = 64;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const ProgramBinaryLoadParams &params)
+{
+    return os << params.backendAndStory().substr(1);
+}
+
+struct ProgramBinary
+{
+    GLenum format = GL_NONE;
+    std::vector<uint8_t> data;
+};
+
+// Generates a fragment shader with a typical mix of uniforms.  |variant| changes a constant so
+// that every program in the corpus is distinct.
+std::string GenerateFragmentShader(unsigned int variant)
+{
+    std::stringstream fs;
+    fs << "#version 300 es\n"
+          "precision highp float;\n"
+          "struct Light { vec4 position; vec4 color; float range; };\n"
+          "uniform Light uLights[4];\n"
+          "uniform mat4 uTransforms[8];\n"
+          "uniform vec4 uParams[16];\n"
+          "uniform sampler2D uTextures[4];\n"
+          "uniform Material { vec4 diffuse; vec4 specular; float shininess; } uMaterial;\n"
+          "uniform float uTime;\n"
+          "out vec4 color;\n"
+          "void main()\n"
+          "{\n"
+          "    vec4 result = uMaterial.diffuse * float("
+       << variant
+       << ");\n"
+          "    for (int i = 0; i < 4; ++i)\n"
+          "    {\n"
+          "        result += uLights[i].color * uLights[i].range + uLights[i].position;\n"
+          "    }\n"
+          "    result += texture(uTextures[0], uParams[0].xy);\n"
+          "    result += texture(uTextures[1], uParams[1].xy);\n"
+          "    result += texture(uTextures[2], uParams[2].xy);\n"
+          "    result += texture(uTextures[3], uParams[3].xy);\n"
+          "    for (int i = 0; i < 8; ++i)\n"
+          "    {\n"
+          "        result += uTransforms[i] * uParams[i + 8];\n"
+          "    }\n"
+          "    color = result * uMaterial.shininess + uMaterial.specular * uTime;\n"
+          "}\n";
+    return fs.str();
+}
+
+class ProgramBinaryLoadBenchmark : public ANGLERenderTest,
+                                   public ::testing::WithParamInterface<ProgramBinaryLoadParams>
+{
+  public:
+    ProgramBinaryLoadBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    void loadPrograms();
+    void deletePrograms();
+
+    std::vector<ProgramBinary> mBinaries;
+    // Programs loaded by the last step.
+    std::vector<GLuint> mPrograms;
+    uint64_t mMemoryPerProgramBytes = 0;
+};
+
+ProgramBinaryLoadBenchmark::ProgramBinaryLoadBenchmark()
+    : ANGLERenderTest("ProgramBinaryLoad", GetParam())
+{
+    mReporter->RegisterImportantMetric(".memory_per_program", "sizeInBytes");
+}
+
+void ProgramBinaryLoadBenchmark::initializeBenchmark()
+{
+    GLint binaryFormatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount);
+    if (binaryFormatCount == 0)
+    {
+        skipTest("No program binary formats supported");
+        return;
+    }
+
+    // The linked programs are kept alive until the corpus is loaded once, so that the loaded
+    // programs can't reuse the memory they would free, and the difference in process memory is
+    // only due to the loaded programs.
+    std::vector<GLuint> linkedPrograms;
+    mBinaries.resize(kProgramCount);
+    for (unsigned int variant = 0; variant < kProgramCount; ++variant)
+    {
+        GLuint program =
+            CompileProgram(essl3_shaders::vs::Simple(), GenerateFragmentShader(variant).c_str());
+        ASSERT_NE(0u, program);
+
+        GLint binaryLength = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+        ASSERT_GT(binaryLength, 0);
+
+        ProgramBinary &binary = mBinaries[variant];
+        binary.data.resize(binaryLength);
+        glGetProgramBinary(program, binaryLength, nullptr, &binary.format, binary.data.data());
+
+        linkedPrograms.push_back(program);
+    }
+
+    mPrograms.reserve(kProgramCount);
+
+    const uint64_t memoryBeforeKB = GetProcessMemoryUsageKB();
+    loadPrograms();
+    const uint64_t memoryAfterKB = GetProcessMemoryUsageKB();
+    if (memoryAfterKB > memoryBeforeKB)
+    {
+        mMemoryPerProgramBytes = (memoryAfterKB - memoryBeforeKB) * 1000 / kProgramCount;
+    }
+
+    for (GLuint program : linkedPrograms)
+    {
+        glDeleteProgram(program);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ProgramBinaryLoadBenchmark::destroyBenchmark()
+{
+    deletePrograms();
+
+    recordIntegerMetric(".memory_per_program", static_cast<size_t>(mMemoryPerProgramBytes),
+                        "sizeInBytes");
+}
+
+void ProgramBinaryLoadBenchmark::deletePrograms()
+{
+    for (GLuint program : mPrograms)
+    {
+        glDeleteProgram(program);
+    }
+    mPrograms.clear();
+}
+
+void ProgramBinaryLoadBenchmark::drawBenchmark()
+{
+    deletePrograms();
+    loadPrograms();
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ProgramBinaryLoadBenchmark::loadPrograms()
+{
+    for (const ProgramBinary &binary : mBinaries)
+    {
+        GLuint program = glCreateProgram();
+        glProgramBinary(program, binary.format, binary.data.data(),
+                        static_cast<GLsizei>(binary.data.size()));
+
+        GLint linkStatus = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+        ASSERT_EQ(GL_TRUE, linkStatus);
+
+        glGetUniformLocation(program, "uTime");
+        glGetUniformLocation(program, "uTransforms");
+        glGetUniformBlockIndex(program, "Material");
+
+        mPrograms.push_back(program);
+    }
+}
+
+ProgramBinaryLoadParams D3D11Params()
+{
+    ProgramBinaryLoadParams params;
+    params.eglParameters = egl_platform::D3D11();
+    return params;
+}
+
+ProgramBinaryLoadParams OpenGLOrGLESParams()
+{
+    ProgramBinaryLoadParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES();
+    return params;
+}
+
+ProgramBinaryLoadParams VulkanParams()
+{
+    ProgramBinaryLoadParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    return params;
+}
+
+}  // anonymous namespace
+
+TEST_P(ProgramBinaryLoadBenchmark, Run)
+{
+    run();
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ProgramBinaryLoadBenchmark);
+ANGLE_INSTANTIATE_TEST(ProgramBinaryLoadBenchmark,
+                       D3D11Params(),
+                       OpenGLOrGLESParams(),
+                       VulkanParams());
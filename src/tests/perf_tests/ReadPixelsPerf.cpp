@@ -0,0 +1,356 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ReadPixelsPerf:
+//   Performance tests for glReadPixels.  Covers the format conversions done on the CPU when packing
+//   pixels (both the fast copy functions and the generic read/write path), and reading back the
+//   default framebuffer with emulated pre-rotation, either to client memory or to a pixel pack
+//   buffer.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+#include <vector>
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 5;
+constexpr GLsizei kFramebufferSize        = 1024;
+
+enum class ReadFormat
+{
+    // Identical formats; a plain memcpy per row.
+    RGBA8ToRGBA8,
+    // Red/blue swizzle through a fast copy function.
+    RGBA8ToBGRA8,
+    // Unorm expansion through a fast copy function.
+    RGB565ToRGBA8,
+    // Half-float to float through a fast copy function.
+    RGBA16FToRGBA32F,
+    // No fast copy function; goes through the generic read/write path.
+    RGB10A2ToRGBA8,
+};
+
+enum class PreRotation
+{
+    _0,
+    _90,
+    _180,
+    _270,
+};
+
+struct ReadPixelsParams final : public RenderTestParams
+{
+    ReadPixelsParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+        windowWidth       = 512;
+        windowHeight      = 512;
+    }
+
+    std::string story() const override;
+
+    ReadFormat readFormat   = ReadFormat::RGBA8ToRGBA8;
+    PreRotation preRotation = PreRotation::_0;
+    // If set, the default framebuffer is read instead of an offscreen framebuffer.  This is needed
+    // for pre-rotation to take effect.
+    bool readDefaultFramebuffer = false;
+    // If set, pixels are read into a pixel pack buffer, which is mapped once per step.
+    bool usePixelPackBuffer = false;
+};
+
+std::ostream &operator<<(std::ostream &os, const ReadPixelsParams &params)
+{
+    return os << params.backendAndStory().substr(1);
+}
+
+std::string ReadPixelsParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+
+    switch (readFormat)
+    {
+        case ReadFormat::RGBA8ToRGBA8:
+            strstr << "_rgba8_to_rgba8";
+            break;
+        case ReadFormat::RGBA8ToBGRA8:
+            strstr << "_rgba8_to_bgra8";
+            break;
+        case ReadFormat::RGB565ToRGBA8:
+            strstr << "_rgb565_to_rgba8";
+            break;
+        case ReadFormat::RGBA16FToRGBA32F:
+            strstr << "_rgba16f_to_rgba32f";
+            break;
+        case ReadFormat::RGB10A2ToRGBA8:
+            strstr << "_rgb10a2_to_rgba8";
+            break;
+    }
+
+    if (readDefaultFramebuffer)
+    {
+        strstr << "_default_framebuffer";
+    }
+
+    if (usePixelPackBuffer)
+    {
+        strstr << "_pbo";
+    }
+
+    switch (preRotation)
+    {
+        case PreRotation::_0:
+            break;
+        case PreRotation::_90:
+            strstr << "_prerotate90";
+            break;
+        case PreRotation::_180:
+            strstr << "_prerotate180";
+            break;
+        case PreRotation::_270:
+            strstr << "_prerotate270";
+            break;
+    }
+
+    return strstr.str();
+}
+
+GLenum GetRenderbufferFormat(ReadFormat readFormat)
+{
+    switch (readFormat)
+    {
+        case ReadFormat::RGB565ToRGBA8:
+            return GL_RGB565;
+        case ReadFormat::RGBA16FToRGBA32F:
+            return GL_RGBA16F;
+        case ReadFormat::RGB10A2ToRGBA8:
+            return GL_RGB10_A2;
+        default:
+            return GL_RGBA8;
+    }
+}
+
+void GetReadFormatAndType(ReadFormat readFormat,
+                          GLenum *formatOut,
+                          GLenum *typeOut,
+                          size_t *pixelBytesOut)
+{
+    switch (readFormat)
+    {
+        case ReadFormat::RGBA8ToBGRA8:
+            *formatOut     = GL_BGRA_EXT;
+            *typeOut       = GL_UNSIGNED_BYTE;
+            *pixelBytesOut = 4;
+            break;
+        case ReadFormat::RGBA16FToRGBA32F:
+            *formatOut     = GL_RGBA;
+            *typeOut       = GL_FLOAT;
+            *pixelBytesOut = 16;
+            break;
+        default:
+            *formatOut     = GL_RGBA;
+            *typeOut       = GL_UNSIGNED_BYTE;
+            *pixelBytesOut = 4;
+            break;
+    }
+}
+
+class ReadPixelsBenchmark : public ANGLERenderTest,
+                            public ::testing::WithParamInterface<ReadPixelsParams>
+{
+  public:
+    ReadPixelsBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mFramebuffer  = 0;
+    GLuint mRenderbuffer = 0;
+    GLuint mPackBuffer   = 0;
+    GLsizei mWidth       = 0;
+    GLsizei mHeight      = 0;
+    GLenum mReadFormat   = GL_NONE;
+    GLenum mReadType     = GL_NONE;
+    std::vector<uint8_t> mPixels;
+};
+
+ReadPixelsBenchmark::ReadPixelsBenchmark() : ANGLERenderTest("ReadPixels", GetParam())
+{
+    const ReadPixelsParams &params = GetParam();
+
+    if (params.readFormat == ReadFormat::RGBA8ToBGRA8)
+    {
+        addExtensionPrerequisite("GL_EXT_read_format_bgra");
+    }
+    if (params.readFormat == ReadFormat::RGBA16FToRGBA32F)
+    {
+        addExtensionPrerequisite("GL_EXT_color_buffer_float");
+    }
+}
+
+void ReadPixelsBenchmark::initializeBenchmark()
+{
+    const ReadPixelsParams &params = GetParam();
+
+    if (params.readDefaultFramebuffer)
+    {
+        mWidth  = getWindow()->getWidth();
+        mHeight = getWindow()->getHeight();
+    }
+    else
+    {
+        mWidth  = kFramebufferSize;
+        mHeight = kFramebufferSize;
+
+        glGenRenderbuffers(1, &mRenderbuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, mRenderbuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GetRenderbufferFormat(params.readFormat), mWidth,
+                              mHeight);
+
+        glGenFramebuffers(1, &mFramebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                                  mRenderbuffer);
+        ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    }
+
+    size_t pixelBytes = 0;
+    GetReadFormatAndType(params.readFormat, &mReadFormat, &mReadType, &pixelBytes);
+    mPixels.resize(static_cast<size_t>(mWidth) * mHeight * pixelBytes);
+
+    if (params.usePixelPackBuffer)
+    {
+        glGenBuffers(1, &mPackBuffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, mPackBuffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, mPixels.size(), nullptr, GL_STREAM_READ);
+    }
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glViewport(0, 0, mWidth, mHeight);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ReadPixelsBenchmark::destroyBenchmark()
+{
+    glDeleteFramebuffers(1, &mFramebuffer);
+    glDeleteRenderbuffers(1, &mRenderbuffer);
+    glDeleteBuffers(1, &mPackBuffer);
+}
+
+void ReadPixelsBenchmark::drawBenchmark()
+{
+    const ReadPixelsParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        // Vary the contents so the readback can't be skipped.
+        glClearColor(static_cast<float>(iteration % 2), 0.25f, 0.5f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glReadPixels(0, 0, mWidth, mHeight, mReadFormat, mReadType,
+                     params.usePixelPackBuffer ? nullptr : mPixels.data());
+    }
+
+    if (params.usePixelPackBuffer)
+    {
+        // Only the last readback is waited on, like a capture pipeline that consumes every frame.
+        void *mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, mPixels.size(), GL_MAP_READ_BIT);
+        ASSERT_NE(mapped, nullptr);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+ReadPixelsParams D3D11Params(ReadFormat readFormat)
+{
+    ReadPixelsParams params;
+    params.eglParameters = egl_platform::D3D11();
+    params.readFormat    = readFormat;
+    if (readFormat == ReadFormat::RGBA16FToRGBA32F || readFormat == ReadFormat::RGB10A2ToRGBA8)
+    {
+        params.majorVersion = 3;
+    }
+    return params;
+}
+
+ReadPixelsParams VulkanParams(ReadFormat readFormat)
+{
+    ReadPixelsParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    params.readFormat    = readFormat;
+    if (readFormat == ReadFormat::RGBA16FToRGBA32F || readFormat == ReadFormat::RGB10A2ToRGBA8)
+    {
+        params.majorVersion = 3;
+    }
+    return params;
+}
+
+ReadPixelsParams VulkanDefaultFramebufferParams(PreRotation preRotation, bool usePixelPackBuffer)
+{
+    ReadPixelsParams params;
+    params.eglParameters          = egl_platform::VULKAN();
+    params.readDefaultFramebuffer = true;
+    params.preRotation            = preRotation;
+    params.usePixelPackBuffer     = usePixelPackBuffer;
+    if (usePixelPackBuffer)
+    {
+        params.majorVersion = 3;
+    }
+
+    switch (preRotation)
+    {
+        case PreRotation::_0:
+            break;
+        case PreRotation::_90:
+            params.eglParameters.enable(Feature::EmulatedPrerotation90);
+            break;
+        case PreRotation::_180:
+            params.eglParameters.enable(Feature::EmulatedPrerotation180);
+            break;
+        case PreRotation::_270:
+            params.eglParameters.enable(Feature::EmulatedPrerotation270);
+            break;
+    }
+
+    return params;
+}
+
+}  // anonymous namespace
+
+TEST_P(ReadPixelsBenchmark, Run)
+{
+    run();
+}
+
+using namespace params;
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ReadPixelsBenchmark);
+ANGLE_INSTANTIATE_TEST(ReadPixelsBenchmark,
+                       D3D11Params(ReadFormat::RGBA8ToRGBA8),
+                       D3D11Params(ReadFormat::RGBA8ToBGRA8),
+                       D3D11Params(ReadFormat::RGB565ToRGBA8),
+                       D3D11Params(ReadFormat::RGBA16FToRGBA32F),
+                       D3D11Params(ReadFormat::RGB10A2ToRGBA8),
+                       VulkanParams(ReadFormat::RGBA8ToRGBA8),
+                       VulkanParams(ReadFormat::RGBA8ToBGRA8),
+                       VulkanParams(ReadFormat::RGB565ToRGBA8),
+                       VulkanParams(ReadFormat::RGBA16FToRGBA32F),
+                       VulkanParams(ReadFormat::RGB10A2ToRGBA8),
+                       VulkanDefaultFramebufferParams(PreRotation::_0, false),
+                       VulkanDefaultFramebufferParams(PreRotation::_90, false),
+                       VulkanDefaultFramebufferParams(PreRotation::_180, false),
+                       VulkanDefaultFramebufferParams(PreRotation::_270, false),
+                       VulkanDefaultFramebufferParams(PreRotation::_0, true),
+                       VulkanDefaultFramebufferParams(PreRotation::_90, true),
+                       VulkanDefaultFramebufferParams(PreRotation::_180, true),
+                       VulkanDefaultFramebufferParams(PreRotation::_270, true));
@@ -0,0 +1,242 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SpirvOptimizationPerf:
+//   Performance test for a fragment-heavy pass with and without the spirv-tools optimization of
+//   the generated SPIR-V.  The fragment shader is written the way shader generators tend to
+//   produce them: small helper functions, local structs and arrays, and branches on constants,
+//   which the optimizer inlines, scalarizes and folds away.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 10;
+
+struct SpirvOptimizationParams final : public RenderTestParams
+{
+    SpirvOptimizationParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+        trackGpuTime      = true;
+        majorVersion      = 3;
+        minorVersion      = 0;
+        windowWidth       = 256;
+        windowHeight      = 256;
+    }
+
+    std::string story() const override;
+
+    bool optimizeSpirv = false;
+};
+
+std::ostream &operator<<(std::ostream &os, const SpirvOptimizationParams &params)
+{
+    return os << params.backendAndStory().substr(1);
+}
+
+std::string SpirvOptimizationParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+
+    if (optimizeSpirv)
+    {
+        strstr << "_optimized";
+    }
+
+    return strstr.str();
+}
+
+class SpirvOptimizationBenchmark : public ANGLERenderTest,
+                                   public ::testing::WithParamInterface<SpirvOptimizationParams>
+{
+  public:
+    SpirvOptimizationBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram = 0;
+};
+
+SpirvOptimizationBenchmark::SpirvOptimizationBenchmark()
+    : ANGLERenderTest("SpirvOptimization", GetParam())
+{}
+
+void SpirvOptimizationBenchmark::initializeBenchmark()
+{
+    // A single triangle covering the whole viewport.
+    constexpr char kVS[] = R"(#version 300 es
+out vec2 uv;
+void main()
+{
+    vec2 position = vec2(float((gl_VertexID & 1) * 4 - 1), float((gl_VertexID & 2) * 2 - 1));
+    uv            = position * 0.5 + 0.5;
+    gl_Position   = vec4(position, 0, 1);
+})";
+
+    constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+
+const int kLightCount = 8;
+const bool kUseFog    = false;
+
+struct Light
+{
+    vec3 direction;
+    vec3 color;
+    float intensity;
+};
+
+struct Surface
+{
+    vec3 normal;
+    vec3 albedo;
+    float roughness;
+};
+
+uniform float time;
+in vec2 uv;
+out vec4 color;
+
+float saturate(float x)
+{
+    return clamp(x, 0.0, 1.0);
+}
+
+Light makeLight(int index)
+{
+    Light light;
+    float angle     = float(index) * 0.785398 + time;
+    light.direction = normalize(vec3(cos(angle), sin(angle), 1.0));
+    light.color     = vec3(1.0, 0.5 + 0.5 * float(index) / float(kLightCount), 0.25);
+    light.intensity = 1.0 / float(index + 1);
+    return light;
+}
+
+Surface makeSurface(vec2 coord)
+{
+    Surface surface;
+    surface.normal    = normalize(vec3(coord * 2.0 - 1.0, 1.0));
+    surface.albedo    = vec3(coord, 0.5);
+    surface.roughness = 0.5;
+    return surface;
+}
+
+vec3 shade(Surface surface, Light light)
+{
+    float diffuse  = saturate(dot(surface.normal, light.direction));
+    vec3 halfway   = normalize(light.direction + vec3(0, 0, 1));
+    float specular = pow(saturate(dot(surface.normal, halfway)), 2.0 / surface.roughness);
+    return (surface.albedo * diffuse + vec3(specular)) * light.color * light.intensity;
+}
+
+vec3 applyFog(vec3 c, float depth)
+{
+    if (kUseFog)
+    {
+        return mix(c, vec3(0.5), saturate(depth * 0.1));
+    }
+    return c;
+}
+
+void main()
+{
+    Surface surface = makeSurface(uv);
+
+    Light lights[kLightCount];
+    for (int i = 0; i < kLightCount; ++i)
+    {
+        lights[i] = makeLight(i);
+    }
+
+    vec3 result = vec3(0);
+    for (int i = 0; i < kLightCount; ++i)
+    {
+        result += shade(surface, lights[i]);
+    }
+
+    color = vec4(applyFog(result, 1.0), 1.0);
+})";
+
+    mProgram = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+
+    glUseProgram(mProgram);
+    glUniform1f(glGetUniformLocation(mProgram, "time"), 0.5f);
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    // Perform a draw so the pipeline is created outside the measured steps.
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void SpirvOptimizationBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+}
+
+void SpirvOptimizationBenchmark::drawBenchmark()
+{
+    const SpirvOptimizationParams &params = GetParam();
+
+    startGpuTimer();
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    stopGpuTimer();
+
+    ASSERT_GL_NO_ERROR();
+}
+
+SpirvOptimizationParams MakeParams(const EGLPlatformParameters &eglParameters, bool optimizeSpirv)
+{
+    SpirvOptimizationParams params;
+    params.eglParameters = eglParameters;
+    params.optimizeSpirv = optimizeSpirv;
+    if (optimizeSpirv)
+    {
+        params.eglParameters.enable(Feature::OptimizeSpirv);
+    }
+    return params;
+}
+
+SpirvOptimizationParams VulkanParams(bool optimizeSpirv)
+{
+    return MakeParams(egl_platform::VULKAN(), optimizeSpirv);
+}
+
+SpirvOptimizationParams VulkanSwiftShaderParams(bool optimizeSpirv)
+{
+    return MakeParams(egl_platform::VULKAN_SWIFTSHADER(), optimizeSpirv);
+}
+
+}  // anonymous namespace
+
+TEST_P(SpirvOptimizationBenchmark, Run)
+{
+    run();
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(SpirvOptimizationBenchmark);
+ANGLE_INSTANTIATE_TEST(SpirvOptimizationBenchmark,
+                       VulkanParams(false),
+                       VulkanParams(true),
+                       VulkanSwiftShaderParams(false),
+                       VulkanSwiftShaderParams(true));
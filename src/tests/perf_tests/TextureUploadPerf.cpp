@@ -179,6 +179,16 @@ class PBOCompressedSubImageBenchmark : public TextureUploadBenchmarkBase
     GLuint mPBO;
 };
 
+// Uploads many small sub-rectangles to a texture before it is first used, like glyphs being
+// rasterized into a font atlas.
+class TextureUploadGlyphAtlasBenchmark : public TextureUploadBenchmarkBase
+{
+  public:
+    TextureUploadGlyphAtlasBenchmark() : TextureUploadBenchmarkBase("TexSubImageGlyphAtlas") {}
+
+    void drawBenchmark() override;
+};
+
 class TextureUploadETC2TranscodingBenchmark : public TextureUploadBenchmarkBase
 {
   public:
@@ -379,6 +389,45 @@ void TextureUploadSubImageBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void TextureUploadGlyphAtlasBenchmark::drawBenchmark()
+{
+    constexpr GLsizei kGlyphSize  = 8;
+    constexpr GLsizei kGlyphCount = 10000;
+
+    const auto &params         = GetParam();
+    const GLsizei glyphsPerRow = params.baseSize / kGlyphSize;
+    const GLsizei atlasHeight  = (kGlyphCount + glyphsPerRow - 1) / glyphsPerRow * kGlyphSize;
+    ASSERT_TRUE(atlasHeight <= params.baseSize);
+
+    startGpuTimer();
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        // Use a new texture every time so that the updates are staged until the draw.
+        GLTexture atlas;
+        glBindTexture(GL_TEXTURE_2D, atlas);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, params.baseSize, atlasHeight, 0, GL_RGBA,
+                     GL_UNSIGNED_BYTE, nullptr);
+
+        // Glyphs are packed in rows, in order.
+        for (GLsizei glyph = 0; glyph < kGlyphCount; ++glyph)
+        {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, (glyph % glyphsPerRow) * kGlyphSize,
+                            (glyph / glyphsPerRow) * kGlyphSize, kGlyphSize, kGlyphSize, GL_RGBA,
+                            GL_UNSIGNED_BYTE, mTextureData.data());
+        }
+
+        // Perform a draw just so the texture data is flushed.  With the position attributes not
+        // set, a constant default value is used, resulting in a very cheap draw.
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    stopGpuTimer();
+
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+
+    ASSERT_GL_NO_ERROR();
+}
+
 void TextureUploadFullMipBenchmark::drawBenchmark()
 {
     const auto &params = GetParam();
@@ -541,6 +590,11 @@ TEST_P(TextureUploadFullMipBenchmark, Run)
     run();
 }
 
+TEST_P(TextureUploadGlyphAtlasBenchmark, Run)
+{
+    run();
+}
+
 TEST_P(PBOSubImageBenchmark, Run)
 {
     run();
@@ -576,6 +630,13 @@ ANGLE_INSTANTIATE_TEST(TextureUploadFullMipBenchmark,
                        VulkanParams(false),
                        VulkanParams(true));
 
+ANGLE_INSTANTIATE_TEST(TextureUploadGlyphAtlasBenchmark,
+                       D3D11Params(false),
+                       MetalParams(false),
+                       OpenGLOrGLESParams(false),
+                       VulkanParams(false),
+                       NullDevice(VulkanParams(false)));
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(PBOSubImageBenchmark);
 ANGLE_INSTANTIATE_TEST(PBOSubImageBenchmark,
                        ES3OpenGLPBOParams(1024, 128),
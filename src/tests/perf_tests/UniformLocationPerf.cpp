@@ -0,0 +1,250 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// UniformLocationPerf:
+//   Performance test for looking up uniform locations and uniform block indices by name on a
+//   program with many active uniforms, as done by engines that query every uniform at load time.
+//   Also reports the process memory taken by each linked copy of that program, which includes the
+//   name index these lookups use.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/system_utils.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 10000;
+
+// Number of uniforms of each kind declared in the fragment shader.
+constexpr size_t kScalarUniformCount = 128;
+constexpr size_t kArrayUniformCount  = 32;
+constexpr size_t kArrayUniformSize   = 8;
+constexpr size_t kStructUniformCount = 32;
+constexpr size_t kUniformBlockCount  = 8;
+
+// Number of extra copies of the program linked to measure the memory used by each.
+constexpr size_t kMemoryProgramCount = 256;
+
+struct UniformLocationParams final : public RenderTestParams
+{
+    UniformLocationParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+        majorVersion      = 3;
+        minorVersion      = 0;
+        windowWidth       = 64;
+        windowHeight      = 64;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const UniformLocationParams &params)
+{
+    return os << params.backendAndStory().substr(1);
+}
+
+class UniformLocationBenchmark : public ANGLERenderTest,
+                                 public ::testing::WithParamInterface<UniformLocationParams>
+{
+  public:
+    UniformLocationBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram = 0;
+    std::vector<GLuint> mMemoryPrograms;
+    uint64_t mMemoryPerProgramBytes = 0;
+    // Names queried with glGetUniformLocation, a mix of plain, subscripted, struct member and
+    // unknown names.
+    std::vector<std::string> mUniformNames;
+    std::vector<std::string> mUniformBlockNames;
+};
+
+UniformLocationBenchmark::UniformLocationBenchmark()
+    : ANGLERenderTest("UniformLocation", GetParam())
+{
+    mReporter->RegisterImportantMetric(".memory_per_program", "sizeInBytes");
+}
+
+void UniformLocationBenchmark::initializeBenchmark()
+{
+    std::stringstream fs;
+    fs << "#version 300 es\n"
+          "precision highp float;\n"
+          "struct S { vec4 a; float b[2]; };\n";
+    for (size_t i = 0; i < kScalarUniformCount; ++i)
+    {
+        fs << "uniform vec4 uScalar" << i << ";\n";
+    }
+    for (size_t i = 0; i < kArrayUniformCount; ++i)
+    {
+        fs << "uniform vec4 uArray" << i << "[" << kArrayUniformSize << "];\n";
+    }
+    for (size_t i = 0; i < kStructUniformCount; ++i)
+    {
+        fs << "uniform S uStruct" << i << ";\n";
+    }
+    for (size_t i = 0; i < kUniformBlockCount; ++i)
+    {
+        fs << "uniform Block" << i << " { vec4 value; } block" << i << ";\n";
+    }
+    fs << "out vec4 color;\n"
+          "void main()\n"
+          "{\n"
+          "    vec4 sum = vec4(0);\n";
+    for (size_t i = 0; i < kScalarUniformCount; ++i)
+    {
+        fs << "    sum += uScalar" << i << ";\n";
+    }
+    for (size_t i = 0; i < kArrayUniformCount; ++i)
+    {
+        for (size_t element = 0; element < kArrayUniformSize; ++element)
+        {
+            fs << "    sum += uArray" << i << "[" << element << "];\n";
+        }
+    }
+    for (size_t i = 0; i < kStructUniformCount; ++i)
+    {
+        fs << "    sum += uStruct" << i << ".a + uStruct" << i << ".b[1];\n";
+    }
+    for (size_t i = 0; i < kUniformBlockCount; ++i)
+    {
+        fs << "    sum += block" << i << ".value;\n";
+    }
+    fs << "    color = sum;\n"
+          "}\n";
+
+    mProgram = CompileProgram(essl3_shaders::vs::Simple(), fs.str().c_str());
+    ASSERT_NE(0u, mProgram);
+
+    // Querying a location resolves the link, so everything built at that point is included.
+    const uint64_t memoryBeforeKB = GetProcessMemoryUsageKB();
+    for (size_t i = 0; i < kMemoryProgramCount; ++i)
+    {
+        GLuint program = CompileProgram(essl3_shaders::vs::Simple(), fs.str().c_str());
+        ASSERT_NE(0u, program);
+        glGetUniformLocation(program, "uScalar0");
+        mMemoryPrograms.push_back(program);
+    }
+    const uint64_t memoryAfterKB = GetProcessMemoryUsageKB();
+    if (memoryAfterKB > memoryBeforeKB)
+    {
+        mMemoryPerProgramBytes = (memoryAfterKB - memoryBeforeKB) * 1000 / kMemoryProgramCount;
+    }
+
+    for (size_t i = 0; i < kScalarUniformCount; ++i)
+    {
+        mUniformNames.push_back("uScalar" + std::to_string(i));
+    }
+    for (size_t i = 0; i < kArrayUniformCount; ++i)
+    {
+        const std::string name = "uArray" + std::to_string(i);
+        mUniformNames.push_back(name);
+        for (size_t element = 0; element < kArrayUniformSize; ++element)
+        {
+            mUniformNames.push_back(name + "[" + std::to_string(element) + "]");
+        }
+    }
+    for (size_t i = 0; i < kStructUniformCount; ++i)
+    {
+        const std::string name = "uStruct" + std::to_string(i);
+        mUniformNames.push_back(name + ".a");
+        mUniformNames.push_back(name + ".b");
+        mUniformNames.push_back(name + ".b[1]");
+        // Not an active uniform.
+        mUniformNames.push_back(name + ".c");
+    }
+
+    for (size_t i = 0; i < kUniformBlockCount; ++i)
+    {
+        mUniformBlockNames.push_back("Block" + std::to_string(i));
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void UniformLocationBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+    for (GLuint program : mMemoryPrograms)
+    {
+        glDeleteProgram(program);
+    }
+
+    recordIntegerMetric(".memory_per_program", static_cast<size_t>(mMemoryPerProgramBytes),
+                        "sizeInBytes");
+}
+
+void UniformLocationBenchmark::drawBenchmark()
+{
+    const UniformLocationParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        const std::string &name = mUniformNames[iteration % mUniformNames.size()];
+        glGetUniformLocation(mProgram, name.c_str());
+
+        if (iteration % 16 == 0)
+        {
+            const std::string &blockName =
+                mUniformBlockNames[(iteration / 16) % mUniformBlockNames.size()];
+            glGetUniformBlockIndex(mProgram, blockName.c_str());
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+UniformLocationParams D3D11Params()
+{
+    UniformLocationParams params;
+    params.eglParameters = egl_platform::D3D11();
+    return params;
+}
+
+UniformLocationParams OpenGLOrGLESParams()
+{
+    UniformLocationParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES();
+    return params;
+}
+
+UniformLocationParams VulkanParams()
+{
+    UniformLocationParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    return params;
+}
+
+UniformLocationParams VulkanNullParams()
+{
+    UniformLocationParams params;
+    params.eglParameters = egl_platform::VULKAN_NULL();
+    return params;
+}
+
+}  // anonymous namespace
+
+TEST_P(UniformLocationBenchmark, Run)
+{
+    run();
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(UniformLocationBenchmark);
+ANGLE_INSTANTIATE_TEST(UniformLocationBenchmark,
+                       D3D11Params(),
+                       OpenGLOrGLESParams(),
+                       VulkanParams(),
+                       VulkanNullParams());
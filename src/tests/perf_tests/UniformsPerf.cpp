@@ -75,6 +75,9 @@ struct UniformsParams final : public RenderTestParams
     DataMode dataMode         = DataMode::REPEAT;
     MatrixLayout matrixLayout = MatrixLayout::NO_TRANSPOSE;
     ProgramMode programMode   = ProgramMode::SINGLE;
+    // If set, each shader declares a single uniform array instead of separate uniforms, and the
+    // whole array is uploaded with one call, like skinning shaders do with their bone matrices.
+    bool uniformArray = false;
 };
 
 std::ostream &operator<<(std::ostream &os, const UniformsParams &params)
@@ -111,6 +114,11 @@ std::string UniformsParams::story() const
         strstr << "_transpose";
     }
 
+    if (uniformArray)
+    {
+        strstr << "_array";
+    }
+
     if (programMode == ProgramMode::MULTIPLE)
     {
         strstr << "_multiprogram";
@@ -142,6 +150,8 @@ class UniformsBenchmark : public ANGLERenderTest,
 
     std::array<GLuint, 2> mPrograms;
     std::vector<GLuint> mUniformLocations;
+    // Number of elements set through each of mUniformLocations.
+    GLsizei mUniformArraySize = 1;
 
     using MatrixData = std::array<std::vector<Matrix4>, 2>;
     MatrixData mMatrixData;
@@ -230,6 +240,13 @@ void UniformsBenchmark::initializeBenchmark()
                << std::endl;
     }
 
+    if (params.uniformArray)
+    {
+        // The data of both arrays is taken from the same list of matrices.
+        ASSERT_EQ(params.numVertexUniforms, params.numFragmentUniforms);
+        mUniformArraySize = static_cast<GLsizei>(params.numVertexUniforms);
+    }
+
     initShaders();
     glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
     glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
@@ -264,6 +281,18 @@ std::string GetUniformLocationName(size_t idx, bool vertexShader)
     return strstr.str();
 }
 
+std::string GetUniformArrayName(bool vertexShader)
+{
+    return vertexShader ? "vs_u" : "fs_u";
+}
+
+std::string GetUniformArrayElementName(size_t idx, bool vertexShader)
+{
+    std::stringstream strstr;
+    strstr << GetUniformArrayName(vertexShader) << "[" << idx << "]";
+    return strstr.str();
+}
+
 void UniformsBenchmark::initShaders()
 {
     const auto &params = GetParam();
@@ -300,9 +329,18 @@ void UniformsBenchmark::initShaders()
     vstrstr << "precision mediump float;\n";
     vstrstr << "in vec4 pos;\n";
 
-    for (size_t i = 0; i < params.numVertexUniforms; i++)
+    if (params.uniformArray)
+    {
+        vstrstr << "uniform " << typeString << " " << GetUniformArrayName(true) << "["
+                << params.numVertexUniforms << "];\n";
+    }
+    else
     {
-        vstrstr << "uniform " << typeString << " " << GetUniformLocationName(i, true) << ";\n";
+        for (size_t i = 0; i < params.numVertexUniforms; i++)
+        {
+            vstrstr << "uniform " << typeString << " " << GetUniformLocationName(i, true)
+                    << ";\n";
+        }
     }
 
     vstrstr << "void main()\n"
@@ -314,7 +352,8 @@ void UniformsBenchmark::initShaders()
         std::size_t pos              = uniformOperation.find(kUniformVarPlaceHolder);
         ASSERT(pos != std::string::npos);
         uniformOperation.replace(pos, kUniformVarPlaceHolder.size(),
-                                 GetUniformLocationName(i, true));
+                                 params.uniformArray ? GetUniformArrayElementName(i, true)
+                                                     : GetUniformLocationName(i, true));
         vstrstr << "    gl_Position += ";
         vstrstr << uniformOperation;
         vstrstr << ";\n";
@@ -326,9 +365,18 @@ void UniformsBenchmark::initShaders()
     fstrstr << "precision mediump float;\n";
     fstrstr << "out vec4 fragColor;\n";
 
-    for (size_t i = 0; i < params.numFragmentUniforms; i++)
+    if (params.uniformArray)
     {
-        fstrstr << "uniform " << typeString << " " << GetUniformLocationName(i, false) << ";\n";
+        fstrstr << "uniform " << typeString << " " << GetUniformArrayName(false) << "["
+                << params.numFragmentUniforms << "];\n";
+    }
+    else
+    {
+        for (size_t i = 0; i < params.numFragmentUniforms; i++)
+        {
+            fstrstr << "uniform " << typeString << " " << GetUniformLocationName(i, false)
+                    << ";\n";
+        }
     }
     fstrstr << "void main()\n"
                "{\n"
@@ -339,7 +387,8 @@ void UniformsBenchmark::initShaders()
         std::size_t pos              = uniformOperation.find(kUniformVarPlaceHolder);
         ASSERT(pos != std::string::npos);
         uniformOperation.replace(pos, kUniformVarPlaceHolder.size(),
-                                 GetUniformLocationName(i, false));
+                                 params.uniformArray ? GetUniformArrayElementName(i, false)
+                                                     : GetUniformLocationName(i, false));
         fstrstr << "    fragColor += ";
         fstrstr << uniformOperation;
         fstrstr << ";\n";
@@ -351,18 +400,27 @@ void UniformsBenchmark::initShaders()
     mPrograms[1] = CompileProgram(vstrstr.str().c_str(), fstrstr.str().c_str());
     ASSERT_NE(0u, mPrograms[1]);
 
-    for (size_t i = 0; i < params.numVertexUniforms; ++i)
+    std::vector<std::string> names;
+    if (params.uniformArray)
     {
-        std::string name = GetUniformLocationName(i, true);
-        GLint location   = glGetUniformLocation(mPrograms[0], name.c_str());
-        ASSERT_NE(-1, location);
-        ASSERT_EQ(location, glGetUniformLocation(mPrograms[1], name.c_str()));
-        mUniformLocations.push_back(location);
+        names.push_back(GetUniformArrayName(true));
+        names.push_back(GetUniformArrayName(false));
+    }
+    else
+    {
+        for (size_t i = 0; i < params.numVertexUniforms; ++i)
+        {
+            names.push_back(GetUniformLocationName(i, true));
+        }
+        for (size_t i = 0; i < params.numFragmentUniforms; ++i)
+        {
+            names.push_back(GetUniformLocationName(i, false));
+        }
     }
-    for (size_t i = 0; i < params.numFragmentUniforms; ++i)
+
+    for (const std::string &name : names)
     {
-        std::string name = GetUniformLocationName(i, false);
-        GLint location   = glGetUniformLocation(mPrograms[0], name.c_str());
+        GLint location = glGetUniformLocation(mPrograms[0], name.c_str());
         ASSERT_NE(-1, location);
         ASSERT_EQ(location, glGetUniformLocation(mPrograms[1], name.c_str()));
         mUniformLocations.push_back(location);
@@ -408,6 +466,7 @@ void UniformsBenchmark::drawBenchmark()
     const auto &params = GetParam();
 
     GLboolean transpose = static_cast<GLboolean>(params.matrixLayout == MatrixLayout::TRANSPOSE);
+    GLsizei count       = mUniformArraySize;
 
     switch (params.dataType)
     {
@@ -415,8 +474,8 @@ void UniformsBenchmark::drawBenchmark()
         {
             auto setFunc = [=](const std::vector<GLuint> &locations, const MatrixData &matrixData,
                                size_t uniform, size_t frameIndex) {
-                glUniformMatrix4fv(locations[uniform], 1, transpose,
-                                   matrixData[frameIndex][uniform].data);
+                glUniformMatrix4fv(locations[uniform], count, transpose,
+                                   matrixData[frameIndex][uniform * count].data);
             };
 
             drawLoop<false>(setFunc);
@@ -426,8 +485,8 @@ void UniformsBenchmark::drawBenchmark()
         {
             auto setFunc = [=](const std::vector<GLuint> &locations, const MatrixData &matrixData,
                                size_t uniform, size_t frameIndex) {
-                glUniformMatrix3x4fv(locations[uniform], 1, transpose,
-                                     matrixData[frameIndex][uniform].data);
+                glUniformMatrix3x4fv(locations[uniform], count, transpose,
+                                     matrixData[frameIndex][uniform * count].data);
             };
 
             drawLoop<false>(setFunc);
@@ -437,8 +496,8 @@ void UniformsBenchmark::drawBenchmark()
         {
             auto setFunc = [=](const std::vector<GLuint> &locations, const MatrixData &matrixData,
                                size_t uniform, size_t frameIndex) {
-                glUniformMatrix3fv(locations[uniform], 1, transpose,
-                                   matrixData[frameIndex][uniform].data);
+                glUniformMatrix3fv(locations[uniform], count, transpose,
+                                   matrixData[frameIndex][uniform * count].data);
             };
 
             drawLoop<false>(setFunc);
@@ -500,6 +559,15 @@ UniformsParams MatrixUniforms(const EGLPlatformParameters &egl,
     return params;
 }
 
+UniformsParams MatrixArrayUniforms(const EGLPlatformParameters &egl,
+                                   DataType dataType,
+                                   MatrixLayout matrixLayout)
+{
+    UniformsParams params = MatrixUniforms(egl, DataMode::UPDATE, dataType, matrixLayout);
+    params.uniformArray   = true;
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(UniformsBenchmark, Run)
@@ -533,4 +601,12 @@ ANGLE_INSTANTIATE_TEST(
     MatrixUniforms(VULKAN(), DataMode::REPEAT, DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE),
     MatrixUniforms(VULKAN(), DataMode::UPDATE, DataType::MAT3x3, MatrixLayout::NO_TRANSPOSE),
     MatrixUniforms(VULKAN(), DataMode::REPEAT, DataType::MAT3x3, MatrixLayout::NO_TRANSPOSE),
-    VectorUniforms(D3D11_NULL(), DataMode::REPEAT, ProgramMode::MULTIPLE));
+    VectorUniforms(D3D11_NULL(), DataMode::REPEAT, ProgramMode::MULTIPLE),
+    MatrixArrayUniforms(VULKAN_NULL(), DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE),
+    MatrixArrayUniforms(VULKAN_NULL(), DataType::MAT4x4, MatrixLayout::TRANSPOSE),
+    MatrixArrayUniforms(VULKAN_NULL(), DataType::MAT3x4, MatrixLayout::NO_TRANSPOSE),
+    MatrixArrayUniforms(VULKAN_NULL(), DataType::MAT3x4, MatrixLayout::TRANSPOSE),
+    MatrixArrayUniforms(VULKAN(), DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE),
+    MatrixArrayUniforms(VULKAN(), DataType::MAT4x4, MatrixLayout::TRANSPOSE),
+    MatrixArrayUniforms(VULKAN(), DataType::MAT3x4, MatrixLayout::NO_TRANSPOSE),
+    MatrixArrayUniforms(VULKAN(), DataType::MAT3x4, MatrixLayout::TRANSPOSE));
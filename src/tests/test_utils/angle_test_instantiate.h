@@ -133,10 +133,12 @@ struct CombinedPrintToStringParamName
 #    define ANGLE_TEST_PLATFORMS_ES32_SYSTEM_EGL ES32_EGL(),
 #endif
 
-#define ANGLE_ALL_TEST_PLATFORMS_ES1                                      \
-    ANGLE_TEST_PLATFORMS_ES1_SYSTEM_EGL                                   \
-    ES1_D3D11(), ES1_METAL(), ES1_OPENGL(), ES1_OPENGLES(), ES1_VULKAN(), \
-        ES1_VULKAN_SWIFTSHADER(), ES1_VULKAN().enable(Feature::EnableParallelCompileAndLink)
+#define ANGLE_ALL_TEST_PLATFORMS_ES1                                                          \
+    ANGLE_TEST_PLATFORMS_ES1_SYSTEM_EGL                                                       \
+    ES1_D3D11(), ES1_METAL(), ES1_OPENGL(), ES1_OPENGLES(), ES1_VULKAN(),                     \
+        ES1_VULKAN_SWIFTSHADER(), ES1_VULKAN().enable(Feature::EnableParallelCompileAndLink), \
+        ES1_VULKAN().enable(Feature::SpecializeGles1ProgramsInBackground),                    \
+        ES1_VULKAN().enable(Feature::ForceGles1DynamicProgram)
 
 #define ANGLE_ALL_TEST_PLATFORMS_ES2                                                               \
     ANGLE_TEST_PLATFORMS_ES2_SYSTEM_EGL                                                            \
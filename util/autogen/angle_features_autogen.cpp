@@ -182,6 +182,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ForceFlushAfterDrawcallUsingShadowmap, "forceFlushAfterDrawcallUsingShadowmap"},
     {Feature::ForceFragmentShaderPrecisionHighpToMediump, "forceFragmentShaderPrecisionHighpToMediump"},
     {Feature::ForceGlErrorChecking, "forceGlErrorChecking"},
+    {Feature::ForceGles1DynamicProgram, "forceGles1DynamicProgram"},
     {Feature::ForceInitShaderVariables, "forceInitShaderVariables"},
     {Feature::ForceMaxCombinedShaderOutputResources, "forceMaxCombinedShaderOutputResources"},
     {Feature::ForceMaxUniformBufferSize16KB, "forceMaxUniformBufferSize16KB"},
@@ -233,6 +234,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::MrtPerfWorkaround, "mrtPerfWorkaround"},
     {Feature::MultisampleColorFormatShaderReadWorkaround, "multisampleColorFormatShaderReadWorkaround"},
     {Feature::MutableMipmapTextureUpload, "mutableMipmapTextureUpload"},
+    {Feature::OptimizeSpirv, "optimizeSpirv"},
     {Feature::OverrideSurfaceFormatRGB8ToRGBA8, "overrideSurfaceFormatRGB8ToRGBA8"},
     {Feature::PackLastRowSeparatelyForPaddingInclusion, "packLastRowSeparatelyForPaddingInclusion"},
     {Feature::PackOverlappingRowsSeparatelyPackBuffer, "packOverlappingRowsSeparatelyPackBuffer"},
@@ -291,6 +293,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SkipPipelineCacheSerialization, "skipPipelineCacheSerialization"},
     {Feature::SkipVSConstantRegisterZero, "skipVSConstantRegisterZero"},
     {Feature::SlowDownMonolithicPipelineCreationForTesting, "slowDownMonolithicPipelineCreationForTesting"},
+    {Feature::SpecializeGles1ProgramsInBackground, "specializeGles1ProgramsInBackground"},
     {Feature::SrgbBlendingBroken, "srgbBlendingBroken"},
     {Feature::Supports16BitInputOutput, "supports16BitInputOutput"},
     {Feature::Supports16BitPushConstant, "supports16BitPushConstant"},
@@ -434,6 +437,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::UseDepthCompareOpDynamicState, "useDepthCompareOpDynamicState"},
     {Feature::UseDepthTestEnableDynamicState, "useDepthTestEnableDynamicState"},
     {Feature::UseDepthWriteEnableDynamicState, "useDepthWriteEnableDynamicState"},
+    {Feature::UseDeviceCapabilitySnapshot, "useDeviceCapabilitySnapshot"},
     {Feature::UseDualPipelineBlobCacheSlots, "useDualPipelineBlobCacheSlots"},
     {Feature::UseEmptyBlobsToEraseOldPipelineCacheFromBlobCache, "useEmptyBlobsToEraseOldPipelineCacheFromBlobCache"},
     {Feature::UseFrontFaceDynamicState, "useFrontFaceDynamicState"},
@@ -454,9 +458,11 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::UseVkEventForImageBarrier, "useVkEventForImageBarrier"},
     {Feature::UseVmaForImageSuballocation, "useVmaForImageSuballocation"},
     {Feature::VaryingsRequireMatchingPrecisionInSpirv, "varyingsRequireMatchingPrecisionInSpirv"},
+    {Feature::VerifyDeviceCapabilitySnapshot, "verifyDeviceCapabilitySnapshot"},
     {Feature::VerifyPipelineCacheInBlobCache, "verifyPipelineCacheInBlobCache"},
     {Feature::VertexIDDoesNotIncludeBaseVertex, "vertexIDDoesNotIncludeBaseVertex"},
     {Feature::WaitIdleBeforeSwapchainRecreation, "waitIdleBeforeSwapchainRecreation"},
+    {Feature::WarmUpInternalPipelines, "warmUpInternalPipelines"},
     {Feature::WarmUpPipelineCacheAtLink, "warmUpPipelineCacheAtLink"},
     {Feature::WarmUpPreRotatePipelineVariations, "warmUpPreRotatePipelineVariations"},
     {Feature::WrapSwitchInIfTrue, "wrapSwitchInIfTrue"},
@@ -182,6 +182,7 @@ enum class Feature
     ForceFlushAfterDrawcallUsingShadowmap,
     ForceFragmentShaderPrecisionHighpToMediump,
     ForceGlErrorChecking,
+    ForceGles1DynamicProgram,
     ForceInitShaderVariables,
     ForceMaxCombinedShaderOutputResources,
     ForceMaxUniformBufferSize16KB,
@@ -233,6 +234,7 @@ enum class Feature
     MrtPerfWorkaround,
     MultisampleColorFormatShaderReadWorkaround,
     MutableMipmapTextureUpload,
+    OptimizeSpirv,
     OverrideSurfaceFormatRGB8ToRGBA8,
     PackLastRowSeparatelyForPaddingInclusion,
     PackOverlappingRowsSeparatelyPackBuffer,
@@ -291,6 +293,7 @@ enum class Feature
     SkipPipelineCacheSerialization,
     SkipVSConstantRegisterZero,
     SlowDownMonolithicPipelineCreationForTesting,
+    SpecializeGles1ProgramsInBackground,
     SrgbBlendingBroken,
     Supports16BitInputOutput,
     Supports16BitPushConstant,
@@ -434,6 +437,7 @@ enum class Feature
     UseDepthCompareOpDynamicState,
     UseDepthTestEnableDynamicState,
     UseDepthWriteEnableDynamicState,
+    UseDeviceCapabilitySnapshot,
     UseDualPipelineBlobCacheSlots,
     UseEmptyBlobsToEraseOldPipelineCacheFromBlobCache,
     UseFrontFaceDynamicState,
@@ -454,9 +458,11 @@ enum class Feature
     UseVkEventForImageBarrier,
     UseVmaForImageSuballocation,
     VaryingsRequireMatchingPrecisionInSpirv,
+    VerifyDeviceCapabilitySnapshot,
     VerifyPipelineCacheInBlobCache,
     VertexIDDoesNotIncludeBaseVertex,
     WaitIdleBeforeSwapchainRecreation,
+    WarmUpInternalPipelines,
     WarmUpPipelineCacheAtLink,
     WarmUpPreRotatePipelineVariations,
     WrapSwitchInIfTrue,